@@ -0,0 +1,339 @@
+/*
+ * benchmark.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+/*********************************************************************************/
+/*								I2C DRIVER BENCHMARK							 */
+/*********************************************************************************/
+/* Runs the I2C driver through representative workloads on the host model of the */
+/* TWI peripheral (SIM/TWI) and reports for each one:							 */
+/* - effective payload throughput in bytes per second of target time			 */
+/* - target CPU cycles, flag polls and register accesses per payload byte		 */
+/* - response gap: cycles between TWINT being set and the driver clearing it	 */
+/*   (average and 99th percentile), i.e. how long the driver stretches the bus	 */
+/* - latency of every driver call in target cycles (median, 99th percentile and	 */
+/*   maximum) and in host nanoseconds (median, includes the model itself)		 */
+/*																				 */
+/* Target cycles are counted on the virtual clock of the model: bus time at the	 */
+/* selected SCL speed plus POLL_CYCLES per poll, ACCESS_CYCLES per register		 */
+/* access and INTERRUPT_CYCLES per interrupt. Build and run on a Linux host:	 */
+/*																				 */
+/* gcc -std=gnu99 -O2 -DHOST_SIMULATION -DF_CPU=8000000UL APP/benchmark.c		 */
+/*     MCAL/I2C/I2C_Program.c MCAL/DIO/DIO_Program.c SIM/TWI/TWI_Program.c		 */
+/*     -o benchmark && ./benchmark												 */
+/*********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../MCAL/I2C/I2C_Interface.h"
+#include "../SIM/TWI/TWI_Interface.h"
+
+/*********************************************************************************/
+/*									CONFIGURATION								 */
+/*********************************************************************************/
+#define DEVICE_ADDRESS				0x50
+#define OWN_ADDRESS					0x03
+#define BUS_FREQUENCY				100000UL
+#define ITERATIONS					64
+#define MAXIMUM_PAYLOAD				256
+#define MAXIMUM_SAMPLES				8192
+#define RUN_LIMIT_CYCLES			100000000UL
+#define PERCENT_MEDIAN				50
+#define PERCENT_TAIL				99
+/*********************************************************************************/
+
+
+/*********************************************************************************/
+/*									WORKLOADS									 */
+/*********************************************************************************/
+#define WORKLOAD_WRITE				0
+#define WORKLOAD_READ				1
+#define WORKLOAD_WRITE_READ			2
+#define WORKLOAD_BYTE_API			3
+#define WORKLOAD_ASYNC				4
+#define WORKLOAD_SLAVE_TRANSMIT		5
+#define WORKLOAD_SLAVE_STREAM		6
+
+typedef struct
+{
+	const char* Name;
+	u8 Kind;
+	u16 Length;
+} Workload;
+
+static const Workload GLOB_AStrWorkloads[] =
+{
+	{ "write 1 byte",			WORKLOAD_WRITE,				1 },
+	{ "write 16-byte burst",	WORKLOAD_WRITE,				16 },
+	{ "write 64-byte burst",	WORKLOAD_WRITE,				64 },
+	{ "write 256-byte burst",	WORKLOAD_WRITE,				256 },
+	{ "read 16-byte burst",		WORKLOAD_READ,				16 },
+	{ "read 64-byte burst",		WORKLOAD_READ,				64 },
+	{ "read 256-byte burst",	WORKLOAD_READ,				256 },
+	{ "register write-read",	WORKLOAD_WRITE_READ,		2 },
+	{ "byte API write 16",		WORKLOAD_BYTE_API,			16 },
+	{ "async write-read 64",	WORKLOAD_ASYNC,				64 },
+	{ "slave transmit 16",		WORKLOAD_SLAVE_TRANSMIT,	16 },
+	{ "slave transmit 64",		WORKLOAD_SLAVE_TRANSMIT,	64 },
+	{ "slave stream 16",		WORKLOAD_SLAVE_STREAM,		16 },
+	{ "slave stream 64",		WORKLOAD_SLAVE_STREAM,		64 },
+};
+
+/* Bit rate and prescaler combinations of the speed sweep */
+static const I2C_SpeedProfile GLOB_AStrProfiles[] =
+{
+	{ 10, 0 }, { 32, 0 }, { 72, 0 }, { 255, 0 },
+	{ 10, 1 }, { 32, 1 }, { 72, 1 }, { 255, 1 },
+	{ 10, 2 }, { 32, 2 }, { 72, 2 }, { 255, 2 },
+	{ 10, 3 }, { 32, 3 }, { 72, 3 }, { 255, 3 },
+};
+/*********************************************************************************/
+
+
+/*********************************************************************************/
+/*									SAMPLES										 */
+/*********************************************************************************/
+typedef struct
+{
+	u32 Count;
+	u32 Values[MAXIMUM_SAMPLES];
+} Samples;
+
+static Samples GLOB_StrCallCycles;
+static Samples GLOB_StrCallNanoseconds;
+static Samples GLOB_StrGaps;
+
+static u8 GLOB_AU8Memory[MAXIMUM_PAYLOAD];
+static TWI_MemorySlave GLOB_StrDevice;
+static u8 GLOB_AU8Tx[MAXIMUM_PAYLOAD + 1];
+static u8 GLOB_AU8Rx[MAXIMUM_PAYLOAD];
+static u32 GLOB_U32Failures;
+static u8 GLOB_U8LastFailure;
+
+static void VidAddSample(Samples* const LOC_PtrSamples, const u32 LOC_U32Value)
+{
+	if (LOC_PtrSamples->Count < MAXIMUM_SAMPLES)
+	{
+		LOC_PtrSamples->Values[LOC_PtrSamples->Count++] = LOC_U32Value;
+	}
+}
+
+static int S32Compare(const void* LOC_PtrFirst, const void* LOC_PtrSecond)
+{
+	const u32 LOC_U32First = *(const u32*)LOC_PtrFirst, LOC_U32Second = *(const u32*)LOC_PtrSecond;
+	return (LOC_U32First > LOC_U32Second) - (LOC_U32First < LOC_U32Second);
+}
+
+static u32 U32Percentile(Samples* const LOC_PtrSamples, const u8 LOC_U8Percent)
+{
+	if (LOC_PtrSamples->Count == 0)
+	{
+		return 0;
+	}
+	qsort(LOC_PtrSamples->Values, LOC_PtrSamples->Count, sizeof(u32), S32Compare);
+	return LOC_PtrSamples->Values[ ( (u64)(LOC_PtrSamples->Count - 1) * LOC_U8Percent ) / 100 ];
+}
+
+static u64 U64HostNanoseconds(void)
+{
+	struct timespec LOC_StrTime;
+	clock_gettime(CLOCK_MONOTONIC, &LOC_StrTime);
+	return (u64)LOC_StrTime.tv_sec * 1000000000ULL + LOC_StrTime.tv_nsec;
+}
+
+static u64 U64Cycles(void)
+{
+	u64 LOC_U64Cycles;
+	TWI_U8GetCycles(&LOC_U64Cycles);
+	return LOC_U64Cycles;
+}
+
+static void VidMonitor(u8 LOC_U8Status, u32 LOC_U32Cycles)
+{
+	(void)LOC_U8Status;
+	VidAddSample(&GLOB_StrGaps, LOC_U32Cycles);
+}
+
+/* Times one driver call in target cycles and host nanoseconds */
+#define MEASURE(call)																	\
+	do																					\
+	{																					\
+		const u64 LOC_U64StartCycles = U64Cycles();										\
+		const u64 LOC_U64StartTime = U64HostNanoseconds();								\
+		call;																			\
+		VidAddSample(&GLOB_StrCallNanoseconds, U64HostNanoseconds() - LOC_U64StartTime);	\
+		VidAddSample(&GLOB_StrCallCycles, U64Cycles() - LOC_U64StartCycles);				\
+	} while (0)
+/*********************************************************************************/
+
+
+/*********************************************************************************/
+/*									WORKLOAD RUNNER								 */
+/*********************************************************************************/
+static void VidReset(void)
+{
+	TWI_U8Reset();
+	TWI_U8AttachMemorySlave(&GLOB_StrDevice, DEVICE_ADDRESS, GLOB_AU8Memory, MAXIMUM_PAYLOAD);
+	TWI_U8SetMonitor(VidMonitor);
+	I2C_U8Init();
+}
+
+/* Runs one iteration of the workload and returns the number of payload bytes */
+static u32 U32RunOnce(const Workload* const LOC_PtrWorkload)
+{
+	u8 LOC_U8Status = I2C_COMPLETED;
+	u16 LOC_U16Count;
+	switch (LOC_PtrWorkload->Kind)
+	{
+	case WORKLOAD_WRITE:
+		/* Register address followed by the data */
+		MEASURE( I2C_U8MasterWriteRead(DEVICE_ADDRESS, GLOB_AU8Tx, LOC_PtrWorkload->Length + 1, NULL, 0, &LOC_U8Status) );
+		break;
+	case WORKLOAD_READ:
+		MEASURE( I2C_U8MasterWriteRead(DEVICE_ADDRESS, GLOB_AU8Tx, 1, GLOB_AU8Rx, LOC_PtrWorkload->Length, &LOC_U8Status) );
+		break;
+	case WORKLOAD_WRITE_READ:
+		MEASURE( I2C_U8MasterWriteRead(DEVICE_ADDRESS, GLOB_AU8Tx, 1, GLOB_AU8Rx, LOC_PtrWorkload->Length, &LOC_U8Status) );
+		break;
+	case WORKLOAD_BYTE_API:
+		MEASURE( I2C_U8MasterStart(&LOC_U8Status) );
+		MEASURE( I2C_U8MasterSendAddressWrite(DEVICE_ADDRESS, &LOC_U8Status) );
+		for (u16 LOC_U16Index = 0; LOC_U16Index <= LOC_PtrWorkload->Length; LOC_U16Index++)
+		{
+			MEASURE( I2C_U8MasterSendData(GLOB_AU8Tx[LOC_U16Index], &LOC_U8Status) );
+		}
+		MEASURE( I2C_U8MasterStop() );
+		LOC_U8Status = ( I2C_RECEIVED_ACK == LOC_U8Status ) ? I2C_COMPLETED : LOC_U8Status;
+		break;
+	case WORKLOAD_ASYNC:
+	{
+		I2C_Transaction LOC_StrTransaction = { 0 };
+		MEASURE( I2C_U8MasterWriteReadAsync(&LOC_StrTransaction, DEVICE_ADDRESS, GLOB_AU8Tx, 1, GLOB_AU8Rx, LOC_PtrWorkload->Length) );
+		TWI_U8RunUntilIdle(RUN_LIMIT_CYCLES);
+		LOC_U8Status = LOC_StrTransaction.Status;
+		break;
+	}
+	case WORKLOAD_SLAVE_TRANSMIT:
+	{
+		TWI_RemoteTransfer LOC_StrRemote = { OWN_ADDRESS, TWI_REMOTE_READ, GLOB_AU8Rx, LOC_PtrWorkload->Length, 0, 0, 0 };
+		TWI_U8RemoteTransfer(&LOC_StrRemote);
+		MEASURE( I2C_U8SlaveWaitForAddress(&LOC_U8Status) );
+		for (LOC_U16Count = 0; LOC_U16Count < LOC_PtrWorkload->Length; LOC_U16Count++)
+		{
+			MEASURE( I2C_U8SlaveSendData(GLOB_AU8Tx[LOC_U16Count], &LOC_U8Status) );
+		}
+		/* The remote master answered the last byte with a NACK: release the bus */
+		I2C_U8ClearFlag();
+		TWI_U8RunUntilIdle(RUN_LIMIT_CYCLES);
+		LOC_U8Status = ( LOC_StrRemote.Done && LOC_StrRemote.Transferred == LOC_PtrWorkload->Length ) ? I2C_COMPLETED : I2C_DATA_ERROR;
+		break;
+	}
+	case WORKLOAD_SLAVE_STREAM:
+	{
+		TWI_RemoteTransfer LOC_StrRemote = { OWN_ADDRESS, TWI_REMOTE_READ, GLOB_AU8Rx, LOC_PtrWorkload->Length, 0, 0, 0 };
+		/* The interrupt routine feeds the whole buffer, nothing runs in the foreground */
+		MEASURE( I2C_U8SlaveTransmitBuffer(GLOB_AU8Tx, LOC_PtrWorkload->Length) );
+		TWI_U8RemoteTransfer(&LOC_StrRemote);
+		TWI_U8RunUntilIdle(RUN_LIMIT_CYCLES);
+		I2C_U8SlaveDisable();
+		LOC_U8Status = ( LOC_StrRemote.Done && LOC_StrRemote.Transferred == LOC_PtrWorkload->Length ) ? I2C_COMPLETED : I2C_DATA_ERROR;
+		break;
+	}
+	default:
+		break;
+	}
+	if (LOC_U8Status != I2C_COMPLETED)
+	{
+		GLOB_U32Failures++;
+		GLOB_U8LastFailure = LOC_U8Status;
+		return 0;
+	}
+	return LOC_PtrWorkload->Length;
+}
+
+static void VidRunWorkload(const Workload* const LOC_PtrWorkload, const char* const LOC_PtrLabel)
+{
+	TWI_Stats LOC_StrBefore, LOC_StrAfter;
+	u64 LOC_U64Cycles;
+	u32 LOC_U32Bytes = 0;
+
+	GLOB_StrCallCycles.Count = 0;
+	GLOB_StrCallNanoseconds.Count = 0;
+	GLOB_StrGaps.Count = 0;
+	GLOB_U32Failures = 0;
+	TWI_U8GetStats(&LOC_StrBefore);
+	LOC_U64Cycles = U64Cycles();
+	for (u16 LOC_U16Iteration = 0; LOC_U16Iteration < ITERATIONS; LOC_U16Iteration++)
+	{
+		LOC_U32Bytes += U32RunOnce(LOC_PtrWorkload);
+	}
+	LOC_U64Cycles = U64Cycles() - LOC_U64Cycles;
+	TWI_U8GetStats(&LOC_StrAfter);
+
+	const u32 LOC_U32Responses = LOC_StrAfter.Responses - LOC_StrBefore.Responses;
+	const u64 LOC_U64Gap = LOC_StrAfter.ResponseCycles - LOC_StrBefore.ResponseCycles;
+	const u32 LOC_U32Polls = LOC_StrAfter.Polls - LOC_StrBefore.Polls;
+	const u32 LOC_U32Accesses = LOC_StrAfter.Accesses - LOC_StrBefore.Accesses;
+	if (GLOB_U32Failures != 0)
+	{
+		printf("%-22s %-10s %u of %u iterations failed (last status %u)\n",
+				LOC_PtrWorkload->Name, LOC_PtrLabel, (unsigned)GLOB_U32Failures, ITERATIONS, GLOB_U8LastFailure);
+	}
+	if (LOC_U32Bytes == 0 || LOC_U64Cycles == 0)
+	{
+		return;
+	}
+	printf("%-22s %-10s %9llu %9.1f %7.1f %7.1f %7.1f %7lu %8lu %8lu %8lu %8lu\n",
+			LOC_PtrWorkload->Name, LOC_PtrLabel,
+			(unsigned long long)( (u64)LOC_U32Bytes * F_CPU / LOC_U64Cycles ),
+			(double)LOC_U64Cycles / LOC_U32Bytes,
+			(double)LOC_U32Polls / LOC_U32Bytes,
+			(double)LOC_U32Accesses / LOC_U32Bytes,
+			LOC_U32Responses ? (double)LOC_U64Gap / LOC_U32Responses : 0.0,
+			(unsigned long)U32Percentile(&GLOB_StrGaps, PERCENT_TAIL),
+			(unsigned long)U32Percentile(&GLOB_StrCallCycles, PERCENT_MEDIAN),
+			(unsigned long)U32Percentile(&GLOB_StrCallCycles, PERCENT_TAIL),
+			(unsigned long)U32Percentile(&GLOB_StrCallCycles, 100),
+			(unsigned long)U32Percentile(&GLOB_StrCallNanoseconds, PERCENT_MEDIAN));
+}
+/*********************************************************************************/
+
+
+int main (void)
+{
+	u32 LOC_U32Achieved;
+	char LOC_AU8Label[16];
+
+	for (u16 LOC_U16Index = 0; LOC_U16Index <= MAXIMUM_PAYLOAD; LOC_U16Index++)
+	{
+		GLOB_AU8Tx[LOC_U16Index] = (u8)LOC_U16Index;
+	}
+	printf("F_CPU = %lu Hz, %u iterations per workload\n", (unsigned long)F_CPU, ITERATIONS);
+	printf("%-22s %-10s %9s %9s %7s %7s %7s %7s %8s %8s %8s %8s\n",
+			"workload", "speed", "bytes/s", "cyc/byte", "poll/B", "io/B", "gap", "gap99", "call50", "call99", "callmax", "host ns");
+
+	/* Speed sweep: single byte writes at every bit rate and prescaler combination */
+	for (u8 LOC_U8Index = 0; LOC_U8Index < sizeof(GLOB_AStrProfiles) / sizeof(GLOB_AStrProfiles[0]); LOC_U8Index++)
+	{
+		const I2C_SpeedProfile* const LOC_PtrProfile = &GLOB_AStrProfiles[LOC_U8Index];
+		VidReset();
+		I2C_U8SetSpeed(LOC_PtrProfile);
+		snprintf(LOC_AU8Label, sizeof(LOC_AU8Label), "%u/%u", LOC_PtrProfile->BitRate, 1u << (2 * LOC_PtrProfile->Prescaler));
+		VidRunWorkload(&GLOB_AStrWorkloads[0], LOC_AU8Label);
+	}
+
+	/* Workloads at the nominal bus frequency */
+	VidReset();
+	I2C_U8SetFrequency(BUS_FREQUENCY, &LOC_U32Achieved);
+	snprintf(LOC_AU8Label, sizeof(LOC_AU8Label), "%luHz", (unsigned long)LOC_U32Achieved);
+	for (u8 LOC_U8Index = 0; LOC_U8Index < sizeof(GLOB_AStrWorkloads) / sizeof(GLOB_AStrWorkloads[0]); LOC_U8Index++)
+	{
+		VidRunWorkload(&GLOB_AStrWorkloads[LOC_U8Index], LOC_AU8Label);
+	}
+	return 0;
+}
@@ -26,6 +26,7 @@
 int main (void)
 {
 	u8 status, sendData;
+	u8 text[LCD_NUMBER_BUFFER_SIZE];
 	I2C_U8Init();
 	LCD_U8Init();
 	I2C_U8MasterStart(&status);
@@ -34,8 +35,13 @@ int main (void)
 	while (1)
 	{
 		I2C_U8MasterReceiveData(&sendData, I2C_SEND_ACK, &status);
-		LCD_U8SendCommand(LCD_CLEAR_DISPLAY);
-		LCD_U8SendNumber(sendData);
+		/* Only the digits that changed reach the panel, without clearing it */
+		LCD_U8FormatU8(sendData, text);
+		LCD_U8FrameSetPosition(LCD_FIRST_ROW, LCD_FIRST_COLUMN);
+		LCD_U8FrameSendString((const u8*)"   ");
+		LCD_U8FrameSetPosition(LCD_FIRST_ROW, LCD_FIRST_COLUMN);
+		LCD_U8FrameSendString(text);
+		LCD_U8FrameFlush();
 		_delay_ms(1000);
 	}
 
@@ -48,26 +54,38 @@ int main (void)
 #include "../MCAL/I2C/I2C_Interface.h"
 #include "../MCAL/DIO/DIO_Interface.h"
 
-#include <util/delay.h>
+#include <avr/interrupt.h>
 
 /*********************************************************************************/
 /*										SLAVE									 */
 /*********************************************************************************/
 
+/* Next value sent to the master: it goes up by one for every byte the master reads */
+static volatile u8 data = 0;
+
+/* Executed from the I2C interrupt whenever the master reads a byte */
+static u8 produceData(u8* const byte)
+{
+	*byte = data++;
+	return 1;
+}
+
 int main (void)
 {
+	u8 text[LCD_NUMBER_BUFFER_SIZE];
 	LCD_U8Init();
 	I2C_U8Init();
-	u8 status, data = 0;
-
-	I2C_U8SlaveWaitForAddress(&status);
+	I2C_U8SlaveTransmitProducer(produceData);
+	sei();
 
 	while (1)
 	{
-		I2C_U8SlaveSendData(data, &status);
-		LCD_U8SendCommand(LCD_CLEAR_DISPLAY);
-		LCD_U8SendNumber(data);
-		data++;
+		LCD_U8FormatU8(data, text);
+		LCD_U8FrameSetPosition(LCD_FIRST_ROW, LCD_FIRST_COLUMN);
+		LCD_U8FrameSendString((const u8*)"   ");
+		LCD_U8FrameSetPosition(LCD_FIRST_ROW, LCD_FIRST_COLUMN);
+		LCD_U8FrameSendString(text);
+		LCD_U8FrameFlush();
 	}
 
 	return 0;
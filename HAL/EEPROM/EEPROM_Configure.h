@@ -0,0 +1,46 @@
+/*
+ * EEPROM_Configure.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef HAL_EEPROM_EEPROM_CONFIGURE_H_
+#define HAL_EEPROM_EEPROM_CONFIGURE_H_
+
+/*****************************************************************************/
+/*      					OPTIONS FOR EEPROM TYPE:				         */
+/*       		  AT24C01 - AT24C02 - AT24C04 - AT24C08 - AT24C16		     */
+/*       		 AT24C32 - AT24C64 - AT24C128 - AT24C256 - AT24C512		     */
+/*****************************************************************************/
+#define TYPE							AT24C02
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   DEVICE ADDRESS - 0x50 WITH THE LEVELS OF THE ADDRESS PINS (A2 A1 A0) IN */
+/*   THE LOWER BITS - RANGE OF OPTIONS: 0x50 ~ 0x57                          */
+/*   (AT24C04/08/16 USE THE LOWER 1/2/3 BITS AS MEMORY BLOCK, LEAVE THEM 0)  */
+/*****************************************************************************/
+#define DEVICE_ADDRESS					0x50
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   SCL FREQUENCY IN HZ USED FOR THE EEPROM - RANGE OF OPTIONS:             */
+/*   1 ~ 400000 (100000 FOR SUPPLY VOLTAGES UNDER 2.5 V)                     */
+/*****************************************************************************/
+#define SCL_FREQUENCY					400000UL
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   ACK POLLING LIMIT - NUMBER OF TIMES THE EEPROM IS ADDRESSED WHILE IT IS */
+/*   BUSY WITH A WRITE CYCLE BEFORE IT IS CONSIDERED NOT RESPONDING          */
+/*   (ONE ATTEMPT TAKES ABOUT 20 SCL PERIODS) - RANGE OF OPTIONS: 1 ~ 65535  */
+/*****************************************************************************/
+#define ACK_POLLING_LIMIT				1000
+/*****************************************************************************/
+
+
+#endif /* HAL_EEPROM_EEPROM_CONFIGURE_H_ */
@@ -0,0 +1,90 @@
+/*
+ * EEPROM_Interface.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef HAL_EEPROM_EEPROM_INTERFACE_H_
+#define HAL_EEPROM_EEPROM_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+/* Driver of a 24Cxx serial EEPROM on the I2C bus (I2C_U8Init is to be called first).
+ * Writes are split at page boundaries and each page is written in one transaction.
+ * The EEPROM does not answer while it programs a page, so instead of waiting a fixed
+ * time the driver addresses it until it acknowledges again (ACK polling). This is done
+ * before the next access, so the write cycle of the last page overlaps with whatever
+ * the application does next.
+ * The EEPROM is an I2C device (see I2C_U8DeviceInit): its accesses run at its own
+ * speed and restore the speed that was set before them.
+ */
+
+
+/************************************************************************************/
+/* 								FUNCTIONS PROTOTYPE					 				*/
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: initializes the EEPROM driver: initializes its device descriptor	*/
+/* at the configured SCL frequency.													*/
+/* Input      : nothing 		                                                    */
+/* Output     : error checking                                                      */
+/************************************************************************************/
+extern u8 EEPROM_U8Init(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes a buffer to the EEPROM, one page per transaction				*/
+/* (START - SLA+W - memory address - data up to the end of the page - STOP).		*/
+/* The function returns as soon as the last page is sent; the EEPROM goes on		*/
+/* programming it (see EEPROM_U8WaitReady).											*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_COMPLETED: if all pages were sent successfully.							*/
+/*  I2C_TIMEOUT: if the EEPROM did not finish a write cycle within					*/
+/*   ACK_POLLING_LIMIT attempts, or the bus stopped responding.						*/
+/*  the other status values of I2C_U8MasterWriteRead if a page failed (the pages	*/
+/*   before it are written).														*/
+/*																					*/
+/* Input: memory address - pointer to the data - number of bytes - pointer to a		*/
+/* variable to receive the status in												*/
+/* Output: error checking (an error is returned if the bytes do not fit in the		*/
+/* memory or while a submitted transaction is running)								*/
+/************************************************************************************/
+extern u8 EEPROM_U8Write(const u16 LOC_U16Address, const u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads a buffer from the EEPROM in one sequential read transaction	*/
+/* (START - SLA+W - memory address - REPEATED START - SLA+R - data - STOP),			*/
+/* whatever the pages it spans.														*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/* the same as EEPROM_U8Write.														*/
+/*																					*/
+/* Input: memory address - pointer to a buffer to receive the data in - number of	*/
+/* bytes - pointer to a variable to receive the status in							*/
+/* Output: error checking (an error is returned if the bytes do not fit in the		*/
+/* memory or while a submitted transaction is running)								*/
+/************************************************************************************/
+extern u8 EEPROM_U8Read(const u16 LOC_U16Address, u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: waits until the EEPROM finishes the write cycle of the last page	*/
+/* written (e.g. before the supply is switched off). It returns at once if there	*/
+/* is no write cycle in progress.													*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_COMPLETED: if the EEPROM is ready.											*/
+/*  I2C_TIMEOUT: if the EEPROM did not acknowledge within ACK_POLLING_LIMIT		*/
+/*   attempts.																		*/
+/*  I2C_ARBITRATION_LOST, I2C_START_ERROR, I2C_ADDRESS_ERROR: if the bus failed.	*/
+/*																					*/
+/* Input: pointer to a variable to receive the status in							*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running)																			*/
+/************************************************************************************/
+extern u8 EEPROM_U8WaitReady(u8* const LOC_U8Status);
+/************************************************************************************/
+
+
+#endif /* HAL_EEPROM_EEPROM_INTERFACE_H_ */
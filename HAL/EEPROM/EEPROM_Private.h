@@ -0,0 +1,100 @@
+/*
+ * EEPROM_Private.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef HAL_EEPROM_EEPROM_PRIVATE_H_
+#define HAL_EEPROM_EEPROM_PRIVATE_H_
+
+/************************************************************************************/
+/* 						  			EEPROM TYPES									*/
+/************************************************************************************/
+#define AT24C01							0
+#define AT24C02							1
+#define AT24C04							2
+#define AT24C08							3
+#define AT24C16							4
+#define AT24C32							5
+#define AT24C64							6
+#define AT24C128						7
+#define AT24C256						8
+#define AT24C512						9
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 				  PAGE SIZE, MEMORY SIZE AND ADDRESS BYTES OF THE TYPE				*/
+/************************************************************************************/
+/* Types up to AT24C16 take one address byte and put the higher address bits		*/
+/* (the memory block) in the device address; bigger types take two address bytes.	*/
+/************************************************************************************/
+#if TYPE == AT24C01
+#define PAGE_SIZE						8
+#define MEMORY_SIZE						128UL
+#define ADDRESS_BYTES					1
+#elif TYPE == AT24C02
+#define PAGE_SIZE						8
+#define MEMORY_SIZE						256UL
+#define ADDRESS_BYTES					1
+#elif TYPE == AT24C04
+#define PAGE_SIZE						16
+#define MEMORY_SIZE						512UL
+#define ADDRESS_BYTES					1
+#elif TYPE == AT24C08
+#define PAGE_SIZE						16
+#define MEMORY_SIZE						1024UL
+#define ADDRESS_BYTES					1
+#elif TYPE == AT24C16
+#define PAGE_SIZE						16
+#define MEMORY_SIZE						2048UL
+#define ADDRESS_BYTES					1
+#elif TYPE == AT24C32
+#define PAGE_SIZE						32
+#define MEMORY_SIZE						4096UL
+#define ADDRESS_BYTES					2
+#elif TYPE == AT24C64
+#define PAGE_SIZE						32
+#define MEMORY_SIZE						8192UL
+#define ADDRESS_BYTES					2
+#elif TYPE == AT24C128
+#define PAGE_SIZE						64
+#define MEMORY_SIZE						16384UL
+#define ADDRESS_BYTES					2
+#elif TYPE == AT24C256
+#define PAGE_SIZE						64
+#define MEMORY_SIZE						32768UL
+#define ADDRESS_BYTES					2
+#elif TYPE == AT24C512
+#define PAGE_SIZE						128
+#define MEMORY_SIZE						65536UL
+#define ADDRESS_BYTES					2
+#else
+#error "Invalid EEPROM type"
+#endif
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  		 OTHER DEFINITIONS									*/
+/************************************************************************************/
+#define MINIMUM_DEVICE_ADDRESS			0x50
+#define MAXIMUM_DEVICE_ADDRESS			0x57
+#define MAXIMUM_SCL_FREQUENCY			400000UL
+#define ONE_ADDRESS_BYTE				1
+#define TWO_ADDRESS_BYTES				2
+#define HIGH_BYTE_SHIFT					8
+#define PAGE_MASK						( PAGE_SIZE - 1 )
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 							  PRIVATE FUNCTIONS PROTOTYPE 							*/
+/************************************************************************************/
+static u8 EEPROM_U8Select(const u16 LOC_U16Address, u8* const LOC_U8Header);
+static u8 EEPROM_U8WritePage(const u16 LOC_U16Address, const u8* const LOC_U8Data, const u8 LOC_U8Length, u8* const LOC_U8Status);
+/************************************************************************************/
+
+
+#endif /* HAL_EEPROM_EEPROM_PRIVATE_H_ */
@@ -0,0 +1,168 @@
+/*
+ * EEPROM_Program.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+/* LIB LAYER */
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/COMMON_MACROS.h"
+/* MCAL LAYER */
+#include "../../MCAL/I2C/I2C_Interface.h"
+/* HAL LAYER */
+#include "EEPROM_Interface.h"
+#include "EEPROM_Configure.h"
+#include "EEPROM_Private.h"
+
+/* The EEPROM as an I2C device: its own speed is used for its transfers only */
+static I2C_Device GLOB_StrDevice;
+/* Memory address followed by the data of the page being written */
+static u8 GLOB_AU8Page[ADDRESS_BYTES + PAGE_SIZE];
+/* Set after a page is sent until the EEPROM acknowledges its address again */
+static u8 GLOB_U8WritePending = 0;
+
+/************************************************************************************/
+/* 						  PUBLIC FUNCTIONS IMPLEMENTATION	  						*/
+/************************************************************************************/
+u8 EEPROM_U8Init(void)
+{
+#if DEVICE_ADDRESS < MINIMUM_DEVICE_ADDRESS || DEVICE_ADDRESS > MAXIMUM_DEVICE_ADDRESS
+#error "Invalid EEPROM device address configuration (out of range)."
+#endif
+#if SCL_FREQUENCY < 1 || SCL_FREQUENCY > MAXIMUM_SCL_FREQUENCY
+#error "Invalid EEPROM SCL frequency configuration. It should be from 1 to 400000."
+#endif
+#if ACK_POLLING_LIMIT < 1 || ACK_POLLING_LIMIT > 65535
+#error "Invalid EEPROM ACK polling limit configuration. It should be from 1 to 65535."
+#endif
+	GLOB_U8WritePending = 0;
+	return I2C_U8DeviceInit(&GLOB_StrDevice, DEVICE_ADDRESS, SCL_FREQUENCY, 0, 0);
+}
+
+u8 EEPROM_U8Write(const u16 LOC_U16Address, const u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status)
+{
+	if ( LOC_U8Data != NULL && LOC_U8Status != NULL && LOC_U16Length != 0 && (u32)LOC_U16Address + LOC_U16Length <= MEMORY_SIZE )
+	{
+		u16 LOC_U16Position = LOC_U16Address, LOC_U16Index = 0;
+		u8 LOC_U8Error = NO_ERROR;
+
+		*LOC_U8Status = I2C_COMPLETED;
+		while (LOC_U16Index < LOC_U16Length && NO_ERROR == LOC_U8Error && I2C_COMPLETED == *LOC_U8Status)
+		{
+			/* Bytes from the address to the end of its page (a page write wraps within the page) */
+			u16 LOC_U16Chunk = PAGE_SIZE - ( LOC_U16Position & PAGE_MASK );
+			if (LOC_U16Chunk > LOC_U16Length - LOC_U16Index)
+			{
+				LOC_U16Chunk = LOC_U16Length - LOC_U16Index;
+			}
+			/* Let the previous page finish programming */
+			LOC_U8Error = EEPROM_U8WaitReady(LOC_U8Status);
+			if (NO_ERROR == LOC_U8Error && I2C_COMPLETED == *LOC_U8Status)
+			{
+				LOC_U8Error = EEPROM_U8WritePage(LOC_U16Position, &LOC_U8Data[LOC_U16Index], (u8)LOC_U16Chunk, LOC_U8Status);
+				/* Even a failed page may have started a write cycle */
+				if (NO_ERROR == LOC_U8Error)
+				{
+					GLOB_U8WritePending = 1;
+				}
+			}
+			LOC_U16Position += LOC_U16Chunk;
+			LOC_U16Index += LOC_U16Chunk;
+		}
+		return LOC_U8Error;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 EEPROM_U8Read(const u16 LOC_U16Address, u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status)
+{
+	if ( LOC_U8Data != NULL && LOC_U8Status != NULL && LOC_U16Length != 0 && (u32)LOC_U16Address + LOC_U16Length <= MEMORY_SIZE )
+	{
+		u8 LOC_U8Header[ADDRESS_BYTES];
+		u8 LOC_U8Error = EEPROM_U8WaitReady(LOC_U8Status);
+
+		if (NO_ERROR == LOC_U8Error && I2C_COMPLETED == *LOC_U8Status)
+		{
+			/* The EEPROM's address counter runs over the whole memory during a sequential read */
+			GLOB_StrDevice.Address = EEPROM_U8Select(LOC_U16Address, LOC_U8Header);
+			LOC_U8Error = I2C_U8DeviceWriteRead(&GLOB_StrDevice, LOC_U8Header, ADDRESS_BYTES, LOC_U8Data, LOC_U16Length, LOC_U8Status);
+		}
+		return LOC_U8Error;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 EEPROM_U8WaitReady(u8* const LOC_U8Status)
+{
+	if (LOC_U8Status != NULL)
+	{
+		u16 LOC_U16Attempt = 0;
+		u8 LOC_U8Error = NO_ERROR;
+		*LOC_U8Status = I2C_COMPLETED;
+		/* START - SLA+W - STOP until the EEPROM acknowledges its address */
+		while (GLOB_U8WritePending && NO_ERROR == LOC_U8Error)
+		{
+			GLOB_StrDevice.Address = DEVICE_ADDRESS;
+			LOC_U8Error = I2C_U8DeviceWrite(&GLOB_StrDevice, NULL, 0, LOC_U8Status);
+			if (NO_ERROR != LOC_U8Error)
+			{
+				/* The bus is taken by a submitted transaction: nothing was sent */
+			}
+			else if (I2C_COMPLETED == *LOC_U8Status)
+			{
+				GLOB_U8WritePending = 0;
+			}
+			else if (I2C_RECEIVED_NACK != *LOC_U8Status)
+			{
+				break;
+			}
+			else if (++LOC_U16Attempt == ACK_POLLING_LIMIT)
+			{
+				*LOC_U8Status = I2C_TIMEOUT;
+				break;
+			}
+		}
+		return LOC_U8Error;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  PRIVATE FUNCTIONS IMPLEMENTATION  						*/
+/************************************************************************************/
+static u8 EEPROM_U8Select(const u16 LOC_U16Address, u8* const LOC_U8Header)
+{
+#if ADDRESS_BYTES == ONE_ADDRESS_BYTE
+	/* The memory block goes in the lower bits of the device address */
+	LOC_U8Header[0] = (u8)LOC_U16Address;
+	return DEVICE_ADDRESS | (u8)( LOC_U16Address >> HIGH_BYTE_SHIFT );
+#else
+	LOC_U8Header[0] = (u8)( LOC_U16Address >> HIGH_BYTE_SHIFT );
+	LOC_U8Header[1] = (u8)LOC_U16Address;
+	return DEVICE_ADDRESS;
+#endif
+}
+
+static u8 EEPROM_U8WritePage(const u16 LOC_U16Address, const u8* const LOC_U8Data, const u8 LOC_U8Length, u8* const LOC_U8Status)
+{
+	GLOB_StrDevice.Address = EEPROM_U8Select(LOC_U16Address, GLOB_AU8Page);
+	for (u8 LOC_U8Index = 0; LOC_U8Index < LOC_U8Length; LOC_U8Index++)
+	{
+		GLOB_AU8Page[ADDRESS_BYTES + LOC_U8Index] = LOC_U8Data[LOC_U8Index];
+	}
+	/* START - SLA+W - memory address - data - STOP in one transaction (the STOP condition starts the write cycle) */
+	return I2C_U8DeviceWrite(&GLOB_StrDevice, GLOB_AU8Page, ADDRESS_BYTES + LOC_U8Length, LOC_U8Status);
+}
+/************************************************************************************/
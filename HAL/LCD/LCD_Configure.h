@@ -9,6 +9,89 @@
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+/*      					OPTIONS FOR LCD TRANSPORT:				         */
+/*       				  DIO_TRANSPORT - I2C_TRANSPORT					     */
+/*   DIO_TRANSPORT: THE LCD PINS ARE CONNECTED TO THE DIO PINS BELOW         */
+/*   I2C_TRANSPORT: THE LCD IS BEHIND A PCF8574 I2C EXPANDER (BACKPACK) IN   */
+/*   4-BIT MODE (I2C_U8Init IS TO BE CALLED BEFORE LCD_U8Init)               */
+/*****************************************************************************/
+#define TRANSPORT				DIO_TRANSPORT
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/* 						   (IN CASE OF DIO TRANSPORT)						 */
+/*      			 OPTIONS FOR WAITING FOR THE LCD CONTROLLER:	         */
+/*       				  POLL_BUSY_FLAG - FIXED_DELAYS					     */
+/*   POLL_BUSY_FLAG: THE BUSY FLAG (DB7) IS READ THROUGH THE RW PIN, WHICH   */
+/*   IS TO BE CONNECTED, AND THE DRIVER GOES ON AS SOON AS THE LCD IS READY  */
+/*   FIXED_DELAYS: EVERY NIBBLE OR BYTE IS FOLLOWED BY A 2 MS DELAY          */
+/*                                                                           */
+/*   BUSY FLAG TIMEOUT IN MICROSECONDS - THE LCD IS CONSIDERED READY IF THE  */
+/*   BUSY FLAG STAYS SET FOR LONGER - RANGE OF OPTIONS: 1600 ~ 65535         */
+/*****************************************************************************/
+#define WAIT_MODE				POLL_BUSY_FLAG
+#define BUSY_FLAG_TIMEOUT		2000
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*      					OPTIONS FOR LCD OUTPUT:				             */
+/*       				 BLOCKING_OUTPUT - QUEUED_OUTPUT				     */
+/*   BLOCKING_OUTPUT: THE LCD FUNCTIONS RETURN ONCE THE LCD TOOK THE DATA    */
+/*   QUEUED_OUTPUT: THE LCD FUNCTIONS PUT THE INSTRUCTIONS AND CHARACTERS IN */
+/*   A QUEUE AND RETURN AT ONCE; LCD_U8Tick SENDS THEM (WAIT_MODE IS NOT     */
+/*   USED)                                                                   */
+/*                                                                           */
+/*   OUTPUT QUEUE SIZE - NUMBER OF INSTRUCTIONS AND CHARACTERS THAT CAN WAIT */
+/*   FOR LCD_U8Tick - OPTIONS (POWERS OF TWO): 2 - 4 - 8 - 16 - 32 - 64 -    */
+/*   128 (64 HOLDS A WHOLE FRAMEBUFFER FLUSH)                                */
+/*                                                                           */
+/*   TICK PERIOD IN MICROSECONDS - TIME BETWEEN TWO CALLS TO LCD_U8Tick -    */
+/*   RANGE OF OPTIONS: 1 ~ 10000                                             */
+/*****************************************************************************/
+#define OUTPUT_MODE				BLOCKING_OUTPUT
+#define OUTPUT_QUEUE_SIZE		64
+#define TICK_PERIOD_US			100
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/* 						   (IN CASE OF I2C TRANSPORT)						 */
+/*   EXPANDER ADDRESS - RANGE OF OPTIONS: 0x20 ~ 0x27 (PCF8574) -            */
+/*   0x38 ~ 0x3F (PCF8574A)                                                  */
+/*   EXPANDER SCL FREQUENCY IN HZ - RANGE OF OPTIONS: 1 ~ 100000             */
+/*****************************************************************************/
+#define EXPANDER_ADDRESS		0x27
+#define EXPANDER_FREQUENCY		100000UL
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/* 						   (IN CASE OF I2C TRANSPORT)						 */
+/*   EXPANDER PINS (P0 ~ P7) CONNECTED TO RS, RW, E AND THE BACKLIGHT -      */
+/*   RANGE OF OPTIONS: 0 ~ 7                                                 */
+/*   EXPANDER PIN CONNECTED TO DB4 (DB5 ~ DB7 FOLLOW IT IN AN ASCENDING      */
+/*   ORDER) - RANGE OF OPTIONS: 0 ~ 4                                        */
+/*****************************************************************************/
+#define EXPANDER_RS_PIN			0
+#define EXPANDER_RW_PIN			1
+#define EXPANDER_ENABLE_PIN		2
+#define EXPANDER_BACKLIGHT_PIN	3
+#define EXPANDER_DATA_PIN		4
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/* 						   (IN CASE OF I2C TRANSPORT)						 */
+/*      					OPTIONS FOR BACKLIGHT:				             */
+/*       				  BACKLIGHT_ON - BACKLIGHT_OFF					     */
+/*****************************************************************************/
+#define BACKLIGHT				BACKLIGHT_ON
+/*****************************************************************************/
+
+
 /*****************************************************************************/
 /*      					OPTIONS FOR RS PORT:				             */
 /*       		DIO_PORTA - DIO_PORTB - DIO_PORTC - DIO_PORTD			     */
@@ -123,4 +206,22 @@
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+/*      		 OPTIONS FOR FIXED-POINT NUMBERS DECIMAL DIGITS        		 */
+/*       	  			 	  	 0 - 1 - 2 - 3 - 4	     			 		 */
+/*****************************************************************************/
+#define FIXED_POINT_DECIMALS	2
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*      			   OPTIONS FOR THE FRAMEBUFFER			         		 */
+/*       	  	  ENABLE_FRAMEBUFFER - DISABLE_FRAMEBUFFER	     			 */
+/*   A COPY OF THE DISPLAY IN RAM (2 BYTES PER CHARACTER) THAT IS SENT TO    */
+/*   THE PANEL BY LCD_U8FrameFlush (ENTRY MODE IS TO BE A NOSHIFT ONE)       */
+/*****************************************************************************/
+#define FRAMEBUFFER				ENABLE_FRAMEBUFFER
+/*****************************************************************************/
+
+
 #endif
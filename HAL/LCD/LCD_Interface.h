@@ -6,6 +6,13 @@
 /* It is assumed in case of 8-bit mode and 4-bit mode that all data pins (DB0 ~ DB7)
  * are connected on the same port and in an ascending order. In case of 4-bit mode,
  * only DB4~DB7 are available for use.
+ * With the I2C transport (a PCF8574 backpack), a command or a character is sent in
+ * one I2C transaction and LCD_U8SendString sends the whole string in one transaction.
+ * Each transaction runs at EXPANDER_FREQUENCY and puts back the speed in use before
+ * it. A blocking send returns an error without touching the bus while a submitted
+ * I2C transaction is running.
+ * With queued output, the sending functions return an error if the queue is full
+ * (LCD_U8SendString queues the whole string or nothing).
  */
 
 
@@ -97,6 +104,13 @@
 #define LCD_SECOND_ROW						1
 /************************************************************************************/
 
+/************************************************************************************/
+/*				  SIZE OF A BUFFER FOR THE NUMBER FORMATTING FUNCTIONS				*/
+/*		  (a sign, 10 integer digits, a point, 4 decimal digits and the null)		*/
+/************************************************************************************/
+#define LCD_NUMBER_BUFFER_SIZE				17
+/************************************************************************************/
+
 
 /************************************************************************************/
 /* 								FUNCTIONS PROTOTYPE					 				*/
@@ -135,12 +149,57 @@ extern u8 LCD_U8Init(void);
 
 /************************************************************************************/
 /* Description: displays a signed number on the LCD panel  							*/
+/* (floating-point arithmetic: the integer and fixed-point functions below are		*/
+/* much faster)																		*/
 /* Input      : Signed Number		                                                */
 /* Output     : Error Checking                                                      */
 /************************************************************************************/
 extern u8 LCD_U8SendNumber(const f64 LOC_S64Number);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: displays an unsigned/signed integer on the LCD panel (the digits	*/
+/* are sent as one string)															*/
+/* Input      : Number				                                                */
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8SendU8(const u8 LOC_U8Number);
+extern u8 LCD_U8SendU16(const u16 LOC_U16Number);
+extern u8 LCD_U8SendU32(const u32 LOC_U32Number);
+extern u8 LCD_U8SendS32(const s32 LOC_S32Number);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: displays a signed fixed-point number (Qm.n: the lower n bits are	*/
+/* the fraction) on the LCD panel, rounded to FIXED_POINT_DECIMALS decimal digits	*/
+/* Input      : Number - Number of fraction bits (0 ~ 16)                           */
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8SendFixedPoint(const s32 LOC_S32Number, const u8 LOC_U8FractionBits);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes the text of an unsigned/signed integer in a buffer (e.g. for	*/
+/* LCD_U8FrameSendString)															*/
+/* Input      : Number - Buffer of LCD_NUMBER_BUFFER_SIZE bytes                     */
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8FormatU8(const u8 LOC_U8Number, u8* const LOC_U8Buffer);
+extern u8 LCD_U8FormatU16(const u16 LOC_U16Number, u8* const LOC_U8Buffer);
+extern u8 LCD_U8FormatU32(const u32 LOC_U32Number, u8* const LOC_U8Buffer);
+extern u8 LCD_U8FormatS32(const s32 LOC_S32Number, u8* const LOC_U8Buffer);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes the text of a signed fixed-point number in a buffer (see		*/
+/* LCD_U8SendFixedPoint)															*/
+/* Input      : Number - Number of fraction bits (0 ~ 16) - Buffer of				*/
+/* LCD_NUMBER_BUFFER_SIZE bytes														*/
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8FormatFixedPoint(const s32 LOC_S32Number, const u8 LOC_U8FractionBits, u8* const LOC_U8Buffer);
+/************************************************************************************/
+
 /************************************************************************************/
 /* Description: Sets the cursor position on a specific row and column on the panel	*/
 /* Input      : Row number - Column number                                          */
@@ -157,5 +216,66 @@ extern u8 LCD_U8SetPosition (const u8 LOC_U8Row, const u8 LOC_U8Column);
 extern u8 LCD_U8DrawExtraCharacter(const u8 *const LOC_U8Character);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: blanks the framebuffer and moves its cursor to the first row and	*/
+/* column (the panel is not touched until LCD_U8FrameFlush)							*/
+/* Input      : Nothing				                                                */
+/* Output     : Error Checking (an error if the framebuffer is disabled)            */
+/************************************************************************************/
+extern u8 LCD_U8FrameClear(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: sets the cursor position of the framebuffer							*/
+/* Input      : Row number - Column number                                          */
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8FrameSetPosition(const u8 LOC_U8Row, const u8 LOC_U8Column);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes a character in the framebuffer at its cursor and moves the	*/
+/* cursor right (characters beyond the end of the row are dropped)					*/
+/* Input      : data	 		                                                    */
+/* Output     : Error Checking (an error if the character was dropped)              */
+/************************************************************************************/
+extern u8 LCD_U8FrameSendData(const u8 LOC_U8Data);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes a string in the framebuffer at its cursor					*/
+/* Input      : array of characters	                                                */
+/* Output     : Error Checking (an error if characters were dropped)                */
+/************************************************************************************/
+extern u8 LCD_U8FrameSendString(const u8 *const LOC_U8String);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: sends the framebuffer to the panel: only the characters that		*/
+/* changed since the last flush are sent, with a DDRAM address command where each	*/
+/* run of changed characters starts (in one I2C transaction with the I2C			*/
+/* transport). The panel is assumed to be written through the framebuffer only		*/
+/* after LCD_U8Init.																*/
+/* Input      : Nothing				                                                */
+/* Output     : Error Checking                                                      */
+/************************************************************************************/
+extern u8 LCD_U8FrameFlush(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: sends the queued instructions and characters (OUTPUT_MODE =		*/
+/* QUEUED_OUTPUT). It is to be called every TICK_PERIOD_US microseconds, from a		*/
+/* timer interrupt routine or from the main loop. Each call either sends the next	*/
+/* character (DIO transport) or submits the next ones as one background I2C		*/
+/* transaction (I2C transport), or lets the LCD finish the last instruction (clear	*/
+/* display and return home take 2 ms). With the I2C transport, the function is		*/
+/* to be called from where the other I2C transactions are submitted.				*/
+/* Input      : Nothing				                                                */
+/* Output     : Error Checking (an error if the output is not queued or an I2C		*/
+/* transaction failed)																*/
+/************************************************************************************/
+extern u8 LCD_U8Tick(void);
+/************************************************************************************/
+
 
 #endif
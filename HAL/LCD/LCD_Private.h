@@ -16,6 +16,20 @@
 /************************************************************************************/
 
 
+/************************************************************************************/
+/* 						  	  INTEGER NUMBERS FORMATTING							*/
+/************************************************************************************/
+/* Digits are found by subtracting powers of ten (no division) */
+#define U32_DIGITS						10
+#define U16_DIGITS						5
+#define NEGATIVE_SIGN					'-'
+#define DECIMAL_POINT					'.'
+#define MAX_FIXED_POINT_DECIMALS		4
+/* The fraction scaled by 10^4 still fits in 32 bits */
+#define MAX_FRACTION_BITS				16
+/************************************************************************************/
+
+
 /************************************************************************************/
 /* 						  		NUMBER OF DATA BITS 								*/
 /************************************************************************************/
@@ -32,6 +46,88 @@
 /************************************************************************************/
 
 
+/************************************************************************************/
+/* 						  		LCD TRANSPORTS		 								*/
+/************************************************************************************/
+#define DIO_TRANSPORT					0
+#define I2C_TRANSPORT					1
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  	  BUSY FLAG DEFINITIONS 								*/
+/************************************************************************************/
+#define POLL_BUSY_FLAG					0
+#define FIXED_DELAYS					1
+/* Clear display and return home take 1.52 ms */
+#define MINIMUM_BUSY_FLAG_TIMEOUT		1600
+#define MAXIMUM_BUSY_FLAG_TIMEOUT		65535
+/* DB7 on the data port */
+#if MODE == EIGHTBIT_MODE
+#define BUSY_FLAG_PIN					DIO_PIN7
+/* Delays (in us) of reading the busy flag once: one E pulse per byte */
+#define BUSY_FLAG_POLL_TIME				2
+#else
+#define BUSY_FLAG_PIN					( DATA_INITIAL_PIN + FOURBITS_DATA - 1 )
+/* Delays (in us) of reading the busy flag once: one E pulse per nibble */
+#define BUSY_FLAG_POLL_TIME				4
+#endif
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  	  OUTPUT QUEUE DEFINITIONS 								*/
+/************************************************************************************/
+#define BLOCKING_OUTPUT					0
+#define QUEUED_OUTPUT					1
+#define OUTPUT_QUEUE_MASK				( OUTPUT_QUEUE_SIZE - 1 )
+#define MAXIMUM_TICK_PERIOD_US			10000
+/* Execution times (in us) of clear display/return home and of the other instructions */
+#define LONG_COMMAND_TIME_US			2000
+#define SHORT_COMMAND_TIME_US			40
+/* Ticks to skip after an instruction is written for the next one to be written	*/
+/* at least the given time later													*/
+#define EXECUTION_TICKS(time)			( ( (time) + TICK_PERIOD_US - 1 ) / TICK_PERIOD_US - 1 )
+/* Characters gathered in one I2C transaction by LCD_U8Tick */
+#define OUTPUT_BURST_CHARACTERS			16
+/* The transport does not wait for the LCD when the queue is drained by LCD_U8Tick */
+#define NO_WAIT							2
+#if OUTPUT_MODE == QUEUED_OUTPUT
+#define TRANSPORT_WAIT					NO_WAIT
+#else
+#define TRANSPORT_WAIT					WAIT_MODE
+#endif
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  	  I2C EXPANDER DEFINITIONS 								*/
+/************************************************************************************/
+#define BACKLIGHT_OFF					0
+#define BACKLIGHT_ON					1
+#define MINIMUM_PCF8574_ADDRESS			0x20
+#define MAXIMUM_PCF8574_ADDRESS			0x27
+#define MINIMUM_PCF8574A_ADDRESS		0x38
+#define MAXIMUM_PCF8574A_ADDRESS		0x3F
+#define MAXIMUM_EXPANDER_FREQUENCY		100000UL
+#define MAXIMUM_EXPANDER_PIN			7
+#define MAXIMUM_EXPANDER_DATA_PIN		4
+#define LOWER_NIBBLE_MASK				0x0F
+/* An expander byte for each edge of E: E high then E low for each nibble */
+#define BYTES_PER_CHARACTER				4
+/* Commands below the entry mode set (clear display, return home) take 1.52 ms */
+#define LONG_COMMAND_LIMIT				0x04
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  	  LCD REGISTERS (RS LEVEL)								*/
+/************************************************************************************/
+#define COMMAND_REGISTER				0
+#define DATA_REGISTER					1
+/************************************************************************************/
+
+
 /************************************************************************************/
 /* 						  NUMBER OF BYTES OF CUSTOM CHARACTERS  					*/
 /************************************************************************************/
@@ -130,11 +226,83 @@
 /************************************************************************************/
 
 
+/************************************************************************************/
+/* 						  	 DIO PORT IMAGES (DIO TRANSPORT)						*/
+/************************************************************************************/
+/* Each nibble or byte is written to the data port in one masked write. In 4-bit	*/
+/* mode, RS and RW are part of that write when they are on the data port.			*/
+/************************************************************************************/
+#define RS_MASK							( 1 << RS_PIN )
+#define RW_MASK							( 1 << RW_PIN )
+#if MODE == EIGHTBIT_MODE
+#define DATA_MASK						0xFF
+#define CONTROL_WITH_DATA				0
+#else
+#define DATA_MASK						( LOWER_NIBBLE_MASK << DATA_INITIAL_PIN )
+#if RS_PORT == DATA_PORT && RW_PORT == DATA_PORT
+#define CONTROL_WITH_DATA				1
+#else
+#define CONTROL_WITH_DATA				0
+#endif
+/* DB4 ~ DB7 images of the higher and the lower nibble of a byte */
+#if DATA_INITIAL_PIN == DIO_PIN4
+#define HIGH_NIBBLE_IMAGE(byte)			( (byte) & ( LOWER_NIBBLE_MASK << FOURBITS_DATA ) )
+#define LOW_NIBBLE_IMAGE(byte)			( (u8)( (byte) << FOURBITS_DATA ) )
+#elif DATA_INITIAL_PIN == DIO_PIN0
+#define HIGH_NIBBLE_IMAGE(byte)			( (byte) >> FOURBITS_DATA )
+#define LOW_NIBBLE_IMAGE(byte)			( (byte) & LOWER_NIBBLE_MASK )
+#else
+#define HIGH_NIBBLE_IMAGE(byte)			( (u8)( ( (byte) >> FOURBITS_DATA ) << DATA_INITIAL_PIN ) )
+#define LOW_NIBBLE_IMAGE(byte)			( (u8)( ( (byte) & LOWER_NIBBLE_MASK ) << DATA_INITIAL_PIN ) )
+#endif
+#endif
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  	  FRAMEBUFFER DEFINITIONS 								*/
+/************************************************************************************/
+#define ENABLE_FRAMEBUFFER				0
+#define DISABLE_FRAMEBUFFER				1
+#define BLANK_CHARACTER					' '
+/* Bit N of the function set selects 1 or 2 display lines */
+#define TWO_LINES_BIT					0x08
+#if MODE == EIGHTBIT_MODE
+#define FRAME_FUNCTION_SET				FUNCTION_SET_8BIT
+#else
+#define FRAME_FUNCTION_SET				FUNCTION_SET_4BIT
+#endif
+#define FRAME_ROWS						( ( FRAME_FUNCTION_SET & TWO_LINES_BIT ) ? 2 : 1 )
+#define FRAME_COLUMNS					( SIXTEENTH_COLUMN + 1 )
+/* The address counter moves by one after each character in the entry mode direction */
+#if ENTRY_MODE == DECREASE_NOSHIFT
+#define FRAME_COLUMN(step)				( SIXTEENTH_COLUMN - (step) )
+#define FRAME_ADDRESS_STEP				(-1)
+#else
+#define FRAME_COLUMN(step)				(step)
+#define FRAME_ADDRESS_STEP				1
+#endif
+/* No DDRAM address command can be equal to it */
+#define FRAME_NO_CURSOR					0xFF
+/************************************************************************************/
+
+
 /************************************************************************************/
 /* 						PRIVATE FUNCTIONS PROTOTYPES 								*/
 /************************************************************************************/
 extern u8 LCD_U8EnableSignal(void);
-extern u8 LCD_U8SendNibble(const u8 LOC_U8Information);
+extern u8 LCD_U8SendNibble(const u8 LOC_U8Image, const u8 LOC_U8Register);
+extern u8 LCD_U8SetControl(const u8 LOC_U8Register);
+extern u8 LCD_U8WriteByte(const u8 LOC_U8Byte, const u8 LOC_U8Register);
+extern u8 LCD_U8WaitReady(void);
+extern u8 LCD_U8BeginBurst(void);
+extern u8 LCD_U8BurstByte(const u8 LOC_U8Byte, const u8 LOC_U8Register);
+extern u8 LCD_U8EndBurst(void);
+extern u8 LCD_U8EncodeFrame(const u8 LOC_U8Byte, const u8 LOC_U8Register, u8* const LOC_U8Frame);
+extern u8 LCD_U8Enqueue(const u8 LOC_U8Byte, const u8 LOC_U8Register);
+extern u8 LCD_U8FrameSend(const u8 LOC_U8Byte, const u8 LOC_U8Register);
+extern u8 LCD_U8FormatDigits(u32 LOC_U32Number, const u8 LOC_U8MinimumDigits, u8* const LOC_U8Buffer);
+extern u8 LCD_U8FormatDigits16(u16 LOC_U16Number, u8* const LOC_U8Buffer);
 
 
 #endif /* LCD_PRIVATE_H_ */
@@ -4,70 +4,400 @@
 #include "../../LIB/BIT_MATH.h"
 /* 		 HAL LAYER 			*/
 #include "../../MCAL/DIO/DIO_Interface.h"
+#include "../../MCAL/I2C/I2C_Interface.h"
 /* 		DELAY LIBRARY 		*/
+#ifdef HOST_SIMULATION
+#include "../../SIM/TWI/TWI_Interface.h"
+#else
 #include <util/delay.h>
+#endif
+#include "LCD_Interface.h"
 #include "LCD_Configure.h"
 #include "LCD_Private.h"
 
+#if TRANSPORT == I2C_TRANSPORT
+static I2C_SpeedProfile GLOB_StrExpanderSpeed;
+/* Speed in use before the current burst, put back by LCD_U8EndBurst */
+static I2C_SpeedProfile GLOB_StrSavedSpeed;
+/* Status of the I2C transaction carrying the current burst */
+static u8 GLOB_U8BurstStatus = I2C_RECEIVED_ACK;
+/* Set while the current burst owns the bus (it was not refused) */
+static u8 GLOB_U8BurstOpen = 0;
+#endif
+
+#if TRANSPORT == DIO_TRANSPORT && TRANSPORT_WAIT == POLL_BUSY_FLAG
+/* The busy flag cannot be read before the function set instruction */
+static u8 GLOB_U8BusyFlagValid = 0;
+#endif
+
+#if OUTPUT_MODE == QUEUED_OUTPUT
+/* Instructions and characters waiting for LCD_U8Tick (free-running indexes) */
+static u8 GLOB_AU8OutputByte[OUTPUT_QUEUE_SIZE];
+static u8 GLOB_AU8OutputRegister[OUTPUT_QUEUE_SIZE];
+static volatile u8 GLOB_U8OutputHead = 0, GLOB_U8OutputTail = 0;
+/* Ticks left before the LCD can take the next instruction */
+static u16 GLOB_U16OutputWait = 0;
+#if TRANSPORT == I2C_TRANSPORT
+static I2C_Transaction GLOB_StrOutputTransaction;
+static u8 GLOB_AU8OutputFrame[OUTPUT_BURST_CHARACTERS * BYTES_PER_CHARACTER];
+#endif
+#endif
+
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+/* What the application draws */
+static u8 GLOB_AU8Frame[FRAME_ROWS][FRAME_COLUMNS];
+/* What the panel last received */
+static u8 GLOB_AU8Panel[FRAME_ROWS][FRAME_COLUMNS];
+static u8 GLOB_U8FrameRow = FIRST_ROW, GLOB_U8FrameColumn = FIRST_COLUMN;
+/* Set when the panel may differ from GLOB_AU8Panel (a flush failed) */
+static u8 GLOB_U8FrameRedraw = 0;
+#endif
+
 /************************************************************************************/
 /* 						  PRIVATE FUNCTIONS IMPLEMENTATION  						*/
 /************************************************************************************/
 
+#if TRANSPORT == DIO_TRANSPORT
 u8 LCD_U8EnableSignal(void)
 {
 	/* Set Enable Signal High*/
 	DIO_U8SetPinValue(ENABLE_PORT, ENABLE_PIN, DIO_PIN_HIGH);
+#if TRANSPORT_WAIT != FIXED_DELAYS
+	/* Wait for E rise time (Tr --> 20 ns) + E pulse width (Tw --> 230 ns) */
+	_delay_us(1);
+	/* Set Enable Signal Low*/
+	DIO_U8SetPinValue(ENABLE_PORT, ENABLE_PIN, DIO_PIN_LOW);
+	/* Wait for the rest of the enable cycle time (Tc --> 500 ns); the LCD
+	 * is waited for before the next instruction (LCD_U8WaitReady or LCD_U8Tick)
+	 */
+	_delay_us(1);
+#else
 	/* Wait for E rise time (Tr --> 20 ns) + E pulse width (Tw --> 230 ns) */
 	_delay_ms(1);
 	/* Set Enable Signal Low*/
 	DIO_U8SetPinValue(ENABLE_PORT, ENABLE_PIN, DIO_PIN_LOW);
 	/* Wait for E fall time (Tf --> 20 ns) */
 	_delay_ms(1);
+#endif
 	return NO_ERROR;
 }
 
-u8 LCD_U8SendNibble(const u8 LOC_U8Information)
+u8 LCD_U8SendNibble(const u8 LOC_U8Image, const u8 LOC_U8Register)
 {
-	/* Send higher nibble to DB4 ~ DB7 */
-	for (u8 LOC_U8WritePin = DATA_INITIAL_PIN, LOC_U8InformationPin = DIO_PIN4; LOC_U8WritePin < DATA_INITIAL_PIN + FOURBITS_DATA; LOC_U8WritePin++, LOC_U8InformationPin++)
-	{
-		DIO_U8SetPinValue(DATA_PORT, LOC_U8WritePin, GET_BIT(LOC_U8Information, LOC_U8InformationPin));
-	}
+#if CONTROL_WITH_DATA
+	/* Send the nibble to DB4 ~ DB7 with RS and RW = 0 (write operation) in one write */
+	DIO_U8SetMaskedPortValue(DATA_PORT, DATA_MASK | RS_MASK | RW_MASK, LOC_U8Image | ( LOC_U8Register << RS_PIN ));
+#else
+	/* Send the nibble to DB4 ~ DB7 (RS and RW are set by LCD_U8SetControl) */
+	(void)LOC_U8Register;
+	DIO_U8SetMaskedPortValue(DATA_PORT, DATA_MASK, LOC_U8Image);
+#endif
 	return NO_ERROR;
 }
 
-/************************************************************************************/
-/* 						  PUBLIC FUNCTIONS IMPLEMENTATION  							*/
-/************************************************************************************/
-
-u8 LCD_U8SendCommand(u8 LOC_U8Command)
+u8 LCD_U8SetControl(const u8 LOC_U8Register)
 {
-	/* Set RS = 0 to select instruction register */
-	DIO_U8SetPinValue(RS_PORT, RS_PIN, DIO_PIN_LOW);
-	/* Set RW = 0 to perform a write operation */
+	/* Set RS to select the register and RW = 0 to perform a write operation */
+#if RS_PORT == RW_PORT
+	DIO_U8SetMaskedPortValue(RS_PORT, RS_MASK | RW_MASK, LOC_U8Register << RS_PIN);
+#else
+	DIO_U8SetPinValue(RS_PORT, RS_PIN, LOC_U8Register);
 	DIO_U8SetPinValue(RW_PORT, RW_PIN, DIO_PIN_LOW);
+#endif
+	return NO_ERROR;
+}
+
+u8 LCD_U8WriteByte(const u8 LOC_U8Byte, const u8 LOC_U8Register)
+{
+#if TRANSPORT_WAIT == POLL_BUSY_FLAG
+	/* Wait until the LCD finishes the previous instruction */
+	LCD_U8WaitReady();
+#endif
 #if MODE == EIGHTBIT_MODE
-	/* Send Command to DB0 ~ DB7 */
-	DIO_U8SetPortValue(DATA_PORT, LOC_U8Command);
+	LCD_U8SetControl(LOC_U8Register);
+	/* Send the byte to DB0 ~ DB7 */
+	DIO_U8SetPortValue(DATA_PORT, LOC_U8Byte);
+	LCD_U8EnableSignal();
 #elif MODE == FOURBIT_MODE
-	/* Send higher nibble to DB4 ~ DB7 */
-	LCD_U8SendNibble(LOC_U8Command);
+#if !CONTROL_WITH_DATA
+	LCD_U8SetControl(LOC_U8Register);
+#endif
+	/* Send the higher nibble then the lower nibble to DB4 ~ DB7 */
+	LCD_U8SendNibble(HIGH_NIBBLE_IMAGE(LOC_U8Byte), LOC_U8Register);
+	LCD_U8EnableSignal();
+	LCD_U8SendNibble(LOW_NIBBLE_IMAGE(LOC_U8Byte), LOC_U8Register);
+	LCD_U8EnableSignal();
 #else
 #error "Incorrect LCD mode"
 #endif
-	LCD_U8EnableSignal();
+	return NO_ERROR;
+}
+
+#if TRANSPORT_WAIT == POLL_BUSY_FLAG
+u8 LCD_U8WaitReady(void)
+{
+	if (GLOB_U8BusyFlagValid)
+	{
+		u8 LOC_U8Busy = DIO_PIN_HIGH;
+		u16 LOC_U16Time = 0;
+		/* Let the LCD drive the data pins */
+		DIO_U8SetMaskedPortDirection(DATA_PORT, DATA_MASK, DIO_PORT_INPUT);
+		/* Set RS = 0 and RW = 1 to read the busy flag and the address counter */
+#if RS_PORT == RW_PORT
+		DIO_U8SetMaskedPortValue(RS_PORT, RS_MASK | RW_MASK, RW_MASK);
+#else
+		DIO_U8SetPinValue(RS_PORT, RS_PIN, DIO_PIN_LOW);
+		DIO_U8SetPinValue(RW_PORT, RW_PIN, DIO_PIN_HIGH);
+#endif
+		/* The timeout counts the delays only, so it is never shorter than configured */
+		while (DIO_PIN_HIGH == LOC_U8Busy && LOC_U16Time < BUSY_FLAG_TIMEOUT)
+		{
+			DIO_U8SetPinValue(ENABLE_PORT, ENABLE_PIN, DIO_PIN_HIGH);
+			/* Wait for data delay time (Tddr --> 160 ns) */
+			_delay_us(1);
+			DIO_U8GetPinValue(DATA_PORT, BUSY_FLAG_PIN, &LOC_U8Busy);
+			DIO_U8SetPinValue(ENABLE_PORT, ENABLE_PIN, DIO_PIN_LOW);
+			_delay_us(1);
 #if MODE == FOURBIT_MODE
-	/* Get The Lower Nibble Ready to Be Sent */
-	LOC_U8Command <<= FOURBITS_DATA;
-	/* Send Lower Nibble to DB4 ~ DB7 */
-	LCD_U8SendNibble(LOC_U8Command);
-	LCD_U8EnableSignal();
+			/* The lower nibble is to be read as well */
+			LCD_U8EnableSignal();
+#endif
+			LOC_U16Time += BUSY_FLAG_POLL_TIME;
+		}
+		/* Back to writing: the LCD releases the data pins once RW is low */
+		DIO_U8SetPinValue(RW_PORT, RW_PIN, DIO_PIN_LOW);
+		DIO_U8SetMaskedPortDirection(DATA_PORT, DATA_MASK, DIO_PORT_OUTPUT);
+		return ( DIO_PIN_HIGH == LOC_U8Busy ) ? ERROR : NO_ERROR;
+	}
+	else
+	{
+		/* Wait for the longest execution time (1.52 ms) */
+		_delay_ms(2);
+		return NO_ERROR;
+	}
+}
+#endif
 #endif
+
+#if TRANSPORT == I2C_TRANSPORT
+u8 LCD_U8BeginBurst(void)
+{
+	u8 LOC_U8Busy;
+	I2C_U8MasterIsBusy(&LOC_U8Busy);
+	if (LOC_U8Busy)
+	{
+		/* The bus belongs to a submitted transaction: nothing is sent until LCD_U8EndBurst */
+		GLOB_U8BurstStatus = I2C_START_ERROR;
+		GLOB_U8BurstOpen = 0;
+		return ERROR;
+	}
+	/* START - SLA+W of the expander at its own speed */
+	I2C_U8GetSpeed(&GLOB_StrSavedSpeed);
+	I2C_U8SetSpeed(&GLOB_StrExpanderSpeed);
+	GLOB_U8BurstOpen = 1;
+	I2C_U8MasterStart(&GLOB_U8BurstStatus);
+	if (I2C_SENT_START == GLOB_U8BurstStatus)
+	{
+		I2C_U8MasterSendAddressWrite(EXPANDER_ADDRESS, &GLOB_U8BurstStatus);
+	}
+	return ( I2C_RECEIVED_ACK == GLOB_U8BurstStatus ) ? NO_ERROR : ERROR;
+}
+
+u8 LCD_U8BurstByte(const u8 LOC_U8Byte, const u8 LOC_U8Register)
+{
+	if (I2C_RECEIVED_ACK == GLOB_U8BurstStatus)
+	{
+		u8 LOC_AU8Frame[BYTES_PER_CHARACTER];
+		u16 LOC_U16Count;
+		LCD_U8EncodeFrame(LOC_U8Byte, LOC_U8Register, LOC_AU8Frame);
+		I2C_U8MasterWriteBuffer(LOC_AU8Frame, BYTES_PER_CHARACTER, &LOC_U16Count, &GLOB_U8BurstStatus);
+		return ( I2C_RECEIVED_ACK == GLOB_U8BurstStatus ) ? NO_ERROR : ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8EncodeFrame(const u8 LOC_U8Byte, const u8 LOC_U8Register, u8* const LOC_U8Frame)
+{
+	/* RW stays low: the LCD is only written */
+	const u8 LOC_U8Control = ( LOC_U8Register << EXPANDER_RS_PIN ) | ( BACKLIGHT << EXPANDER_BACKLIGHT_PIN );
+	const u8 LOC_U8High = ( ( LOC_U8Byte >> FOURBITS_DATA ) << EXPANDER_DATA_PIN ) | LOC_U8Control;
+	const u8 LOC_U8Low = ( ( LOC_U8Byte & LOWER_NIBBLE_MASK ) << EXPANDER_DATA_PIN ) | LOC_U8Control;
+	/* Each nibble is latched by the LCD on the falling edge of E */
+	LOC_U8Frame[0] = LOC_U8High | (1 << EXPANDER_ENABLE_PIN);
+	LOC_U8Frame[1] = LOC_U8High;
+	LOC_U8Frame[2] = LOC_U8Low | (1 << EXPANDER_ENABLE_PIN);
+	LOC_U8Frame[3] = LOC_U8Low;
 	return NO_ERROR;
 }
 
+u8 LCD_U8EndBurst(void)
+{
+	if (GLOB_U8BurstOpen)
+	{
+		/* Send STOP condition unless the bus was lost to another master */
+		if (I2C_ARBITRATION_LOST != GLOB_U8BurstStatus)
+		{
+			I2C_U8MasterStop();
+		}
+		I2C_U8SetSpeed(&GLOB_StrSavedSpeed);
+		GLOB_U8BurstOpen = 0;
+	}
+	return ( I2C_RECEIVED_ACK == GLOB_U8BurstStatus ) ? NO_ERROR : ERROR;
+}
+#endif
+
+#if OUTPUT_MODE == QUEUED_OUTPUT
+u8 LCD_U8Enqueue(const u8 LOC_U8Byte, const u8 LOC_U8Register)
+{
+	const u8 LOC_U8Head = GLOB_U8OutputHead;
+	if ( (u8)(LOC_U8Head - GLOB_U8OutputTail) < OUTPUT_QUEUE_SIZE )
+	{
+		GLOB_AU8OutputByte[LOC_U8Head & OUTPUT_QUEUE_MASK] = LOC_U8Byte;
+		GLOB_AU8OutputRegister[LOC_U8Head & OUTPUT_QUEUE_MASK] = LOC_U8Register;
+		/* Published last, so LCD_U8Tick never takes a half-written entry */
+		GLOB_U8OutputHead = LOC_U8Head + 1;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+#endif
+
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+u8 LCD_U8FrameSend(const u8 LOC_U8Byte, const u8 LOC_U8Register)
+{
+#if TRANSPORT == I2C_TRANSPORT && OUTPUT_MODE == BLOCKING_OUTPUT
+	/* Part of the burst opened by LCD_U8FrameFlush */
+	return LCD_U8BurstByte(LOC_U8Byte, LOC_U8Register);
+#else
+	return ( COMMAND_REGISTER == LOC_U8Register ) ? LCD_U8SendCommand(LOC_U8Byte) : LCD_U8SendData(LOC_U8Byte);
+#endif
+}
+#endif
+
+/* Writes the digits of a number with at least a given number of digits (leading
+ * zeros) and returns how many characters were written
+ */
+u8 LCD_U8FormatDigits(u32 LOC_U32Number, const u8 LOC_U8MinimumDigits, u8* const LOC_U8Buffer)
+{
+	static const u32 LOC_AU32Powers[U32_DIGITS] = { 1000000000UL, 100000000UL, 10000000UL, 1000000UL, \
+													100000UL, 10000UL, 1000UL, 100UL, 10UL, 1UL };
+	u8 LOC_U8Length = 0;
+	for (u8 LOC_U8Index = 0; LOC_U8Index < U32_DIGITS; LOC_U8Index++)
+	{
+		u8 LOC_U8Digit = '0';
+		/* At most 9 subtractions per digit */
+		while (LOC_U32Number >= LOC_AU32Powers[LOC_U8Index])
+		{
+			LOC_U32Number -= LOC_AU32Powers[LOC_U8Index];
+			LOC_U8Digit++;
+		}
+		if (LOC_U8Digit != '0' || LOC_U8Length != 0 || U32_DIGITS - LOC_U8Index <= LOC_U8MinimumDigits)
+		{
+			LOC_U8Buffer[LOC_U8Length++] = LOC_U8Digit;
+		}
+	}
+	LOC_U8Buffer[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
+
+/* The same in 16-bit arithmetic for u8 and u16 numbers */
+u8 LCD_U8FormatDigits16(u16 LOC_U16Number, u8* const LOC_U8Buffer)
+{
+	static const u16 LOC_AU16Powers[U16_DIGITS] = { 10000, 1000, 100, 10, 1 };
+	u8 LOC_U8Length = 0;
+	for (u8 LOC_U8Index = 0; LOC_U8Index < U16_DIGITS; LOC_U8Index++)
+	{
+		u8 LOC_U8Digit = '0';
+		while (LOC_U16Number >= LOC_AU16Powers[LOC_U8Index])
+		{
+			LOC_U16Number -= LOC_AU16Powers[LOC_U8Index];
+			LOC_U8Digit++;
+		}
+		/* The units digit is written even if it is 0 */
+		if (LOC_U8Digit != '0' || LOC_U8Length != 0 || U16_DIGITS - 1 == LOC_U8Index)
+		{
+			LOC_U8Buffer[LOC_U8Length++] = LOC_U8Digit;
+		}
+	}
+	LOC_U8Buffer[LOC_U8Length] = '\0';
+	return LOC_U8Length;
+}
+
+/************************************************************************************/
+/* 						  PUBLIC FUNCTIONS IMPLEMENTATION  							*/
+/************************************************************************************/
+
+u8 LCD_U8SendCommand(u8 LOC_U8Command)
+{
+#if OUTPUT_MODE == QUEUED_OUTPUT
+	/* Sent later by LCD_U8Tick */
+	return LCD_U8Enqueue(LOC_U8Command, COMMAND_REGISTER);
+#elif TRANSPORT == I2C_TRANSPORT
+	u8 LOC_U8Error;
+	/* Send the whole command in one I2C transaction */
+	LCD_U8BeginBurst();
+	LCD_U8BurstByte(LOC_U8Command, COMMAND_REGISTER);
+	LOC_U8Error = LCD_U8EndBurst();
+	if (LOC_U8Command < LONG_COMMAND_LIMIT)
+	{
+		/* Wait for more than 1.52 ms */
+		_delay_ms(2);
+	}
+	return LOC_U8Error;
+#else
+	/* RS = 0 to select instruction register */
+	return LCD_U8WriteByte(LOC_U8Command, COMMAND_REGISTER);
+#endif
+}
+
 u8 LCD_U8Init(void)
 {
+#if TRANSPORT == I2C_TRANSPORT
+#if MODE != FOURBIT_MODE
+#error "The I2C transport works in 4-bit mode only"
+#endif
+#if !( EXPANDER_ADDRESS >= MINIMUM_PCF8574_ADDRESS && EXPANDER_ADDRESS <= MAXIMUM_PCF8574_ADDRESS ) && \
+		!( EXPANDER_ADDRESS >= MINIMUM_PCF8574A_ADDRESS && EXPANDER_ADDRESS <= MAXIMUM_PCF8574A_ADDRESS )
+#error "Incorrect expander address"
+#endif
+#if EXPANDER_FREQUENCY < 1 || EXPANDER_FREQUENCY > MAXIMUM_EXPANDER_FREQUENCY
+#error "Incorrect expander SCL frequency"
+#endif
+#if EXPANDER_RS_PIN > MAXIMUM_EXPANDER_PIN || EXPANDER_RW_PIN > MAXIMUM_EXPANDER_PIN || \
+		EXPANDER_ENABLE_PIN > MAXIMUM_EXPANDER_PIN || EXPANDER_BACKLIGHT_PIN > MAXIMUM_EXPANDER_PIN || \
+		EXPANDER_DATA_PIN > MAXIMUM_EXPANDER_DATA_PIN
+#error "Incorrect expander pins"
+#endif
+#if BACKLIGHT != BACKLIGHT_ON && BACKLIGHT != BACKLIGHT_OFF
+#error "Incorrect backlight option"
+#endif
+	u8 LOC_U8Status, LOC_U8Busy;
+	u32 LOC_U32Achieved;
+	I2C_SpeedProfile LOC_StrSaved;
+	/* The expander pins are high after power-up: take E (and every other pin) low */
+	const u8 LOC_U8Idle = BACKLIGHT << EXPANDER_BACKLIGHT_PIN;
+	I2C_U8ComputeSpeed(EXPANDER_FREQUENCY, &GLOB_StrExpanderSpeed, &LOC_U32Achieved);
+	I2C_U8MasterIsBusy(&LOC_U8Busy);
+	if (LOC_U8Busy)
+	{
+		return ERROR;
+	}
+	I2C_U8GetSpeed(&LOC_StrSaved);
+	I2C_U8SetSpeed(&GLOB_StrExpanderSpeed);
+	I2C_U8MasterWriteRead(EXPANDER_ADDRESS, &LOC_U8Idle, 1, NULL, 0, &LOC_U8Status);
+	/* The bursts below set the expander speed themselves */
+	I2C_U8SetSpeed(&LOC_StrSaved);
+	if (I2C_COMPLETED != LOC_U8Status)
+	{
+		return ERROR;
+	}
+#elif TRANSPORT == DIO_TRANSPORT
 #if RS_PORT >= DIO_PORTA && RS_PORT <= DIO_PORTD
 #if RS_PIN >= DIO_PIN0 && RS_PIN <= DIO_PIN7
 	/* Set RS pin as output */
@@ -104,11 +434,11 @@ u8 LCD_U8Init(void)
 	/* Set data port as output */
 	DIO_U8SetPortDirection(DATA_PORT, DIO_PORT_OUTPUT);
 #elif MODE == FOURBIT_MODE
+#if DATA_INITIAL_PIN > DIO_PIN4
+#error "Incorrect data initial pin (DB7 would be beyond the last pin of the port)"
+#endif
 	/* Set the 4 data pins as output */
-	for (u8 LOC_U8Pin = DATA_INITIAL_PIN; LOC_U8Pin < DATA_INITIAL_PIN + FOURBITS_DATA; LOC_U8Pin++)
-	{
-		DIO_U8SetPinDirection(DATA_PORT, LOC_U8Pin, DIO_PIN_OUTPUT);
-	}
+	DIO_U8SetMaskedPortDirection(DATA_PORT, DATA_MASK, DIO_PORT_OUTPUT);
 #else
 #error "Incorrect LCD mode"
 #endif
@@ -117,6 +447,37 @@ u8 LCD_U8Init(void)
 #endif
 #else
 #error "Incorrect data port"
+#endif
+#if WAIT_MODE == POLL_BUSY_FLAG
+#if BUSY_FLAG_TIMEOUT < MINIMUM_BUSY_FLAG_TIMEOUT || BUSY_FLAG_TIMEOUT > MAXIMUM_BUSY_FLAG_TIMEOUT
+#error "Incorrect busy flag timeout"
+#endif
+#elif WAIT_MODE != FIXED_DELAYS
+#error "Incorrect LCD wait mode"
+#endif
+#if TRANSPORT_WAIT == POLL_BUSY_FLAG
+	GLOB_U8BusyFlagValid = 0;
+#endif
+#else
+#error "Incorrect LCD transport"
+#endif
+#if OUTPUT_MODE == QUEUED_OUTPUT
+#if OUTPUT_QUEUE_SIZE < 2 || OUTPUT_QUEUE_SIZE > 128 || ( OUTPUT_QUEUE_SIZE & OUTPUT_QUEUE_MASK ) != 0
+#error "Incorrect output queue size"
+#endif
+#if TICK_PERIOD_US < 1 || TICK_PERIOD_US > MAXIMUM_TICK_PERIOD_US
+#error "Incorrect tick period"
+#endif
+	/* The instructions below are queued and sent by LCD_U8Tick */
+	GLOB_U8OutputTail = GLOB_U8OutputHead;
+	GLOB_U16OutputWait = 0;
+#if TRANSPORT == I2C_TRANSPORT
+	GLOB_StrOutputTransaction.Speed = &GLOB_StrExpanderSpeed;
+	GLOB_StrOutputTransaction.CallBack = NULL;
+	GLOB_StrOutputTransaction.Status = I2C_COMPLETED;
+#endif
+#elif OUTPUT_MODE != BLOCKING_OUTPUT
+#error "Incorrect LCD output mode"
 #endif
 	/* Wait for more than 30 ms after VDD rises to 4.5V */
 	_delay_ms(50);
@@ -140,8 +501,14 @@ u8 LCD_U8Init(void)
 #else
 #error "Incorrect LCD mode"
 #endif
+#if OUTPUT_MODE == BLOCKING_OUTPUT
 	/* Wait for more than 39 s */
 	_delay_ms(1);
+#endif
+#if TRANSPORT == DIO_TRANSPORT && TRANSPORT_WAIT == POLL_BUSY_FLAG
+	/* The busy flag is valid from now on */
+	GLOB_U8BusyFlagValid = 1;
+#endif
 #if DISPLAY_CONTROL == NODISPLAY_NOCURSOR_NOBLINKING || DISPLAY_CONTROL == NODISPLAY_NOCURSOR_BLINKING || \
 		DISPLAY_CONTROL == NODISPLAY_CURSOR_NOBLINKING || DISPLAY_CONTROL == NODISPLAY_CURSOR_BLINKING || \
 		DISPLAY_CONTROL == DISPLAY_NOCURSOR_NOBLINKING || DISPLAY_CONTROL == DISPLAY_NOCURSOR_BLINKING || \
@@ -151,12 +518,33 @@ u8 LCD_U8Init(void)
 #else
 #error "Incorrect display control"
 #endif
+#if OUTPUT_MODE == BLOCKING_OUTPUT
 	/* Wait for more than 39 s */
 	_delay_ms(1);
+#endif
 	/* Display Clear Instruction */
 	LCD_U8SendCommand(CLEAR_DISPLAY);
+#if OUTPUT_MODE == BLOCKING_OUTPUT
 	/* Wait for more than 1.53 ms */
 	_delay_ms(2);
+#endif
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+	/* The panel is blank now */
+	LCD_U8FrameClear();
+	for (u8 LOC_U8Row = FIRST_ROW; LOC_U8Row < FRAME_ROWS; LOC_U8Row++)
+	{
+		for (u8 LOC_U8Column = FIRST_COLUMN; LOC_U8Column < FRAME_COLUMNS; LOC_U8Column++)
+		{
+			GLOB_AU8Panel[LOC_U8Row][LOC_U8Column] = BLANK_CHARACTER;
+		}
+	}
+	GLOB_U8FrameRedraw = 0;
+#elif FRAMEBUFFER != DISABLE_FRAMEBUFFER
+#error "Incorrect framebuffer option"
+#endif
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER && ENTRY_MODE != INCREASE_NOSHIFT && ENTRY_MODE != DECREASE_NOSHIFT
+#error "The framebuffer needs an entry mode without display shift"
+#endif
 	/* Entry Mode Set Instruction */
 #if ENTRY_MODE == DECREASE_NOSHIFT || ENTRY_MODE == DECREASE_SHIFT || \
 		ENTRY_MODE == INCREASE_NOSHIFT	|| ENTRY_MODE == INCREASE_SHIFT
@@ -169,34 +557,49 @@ u8 LCD_U8Init(void)
 
 u8 LCD_U8SendData(u8 LOC_U8Data)
 {
-	/* Set RS = 1 to select data register */
-	DIO_U8SetPinValue(RS_PORT, RS_PIN, DIO_PIN_HIGH);
-	/* Set RW = 0 to perform a write operation */
-	DIO_U8SetPinValue(RW_PORT, RW_PIN, DIO_PIN_LOW);
-#if MODE == EIGHTBIT_MODE
-	/* Send Data to DB0 ~ DB7 */
-	DIO_U8SetPortValue(DATA_PORT, LOC_U8Data);
-#elif MODE == FOURBIT_MODE
-	/* Send Higher Nibble to DB4 ~ DB7 */
-	LCD_U8SendNibble(LOC_U8Data);
+#if OUTPUT_MODE == QUEUED_OUTPUT
+	/* Sent later by LCD_U8Tick */
+	return LCD_U8Enqueue(LOC_U8Data, DATA_REGISTER);
+#elif TRANSPORT == I2C_TRANSPORT
+	/* Send the whole character in one I2C transaction */
+	LCD_U8BeginBurst();
+	LCD_U8BurstByte(LOC_U8Data, DATA_REGISTER);
+	return LCD_U8EndBurst();
 #else
-#error "Incorrect LCD mode"
-#endif
-	LCD_U8EnableSignal();
-#if MODE == FOURBIT_MODE
-	/* Get The Lower Nibble Ready to Be Sent */
-	LOC_U8Data <<= FOURBITS_DATA;
-	/* Send Lower Nibble to DB4 ~ DB7 */
-	LCD_U8SendNibble(LOC_U8Data);
-	LCD_U8EnableSignal();
+	/* RS = 1 to select data register */
+	return LCD_U8WriteByte(LOC_U8Data, DATA_REGISTER);
 #endif
-	return NO_ERROR;
 }
 
 u8 LCD_U8SendString (const u8 *const LOC_U8String)
 {
 	if (LOC_U8String != NULL)
 	{
+#if OUTPUT_MODE == QUEUED_OUTPUT
+		u8 LOC_U8Length = 0;
+		while (LOC_U8String[LOC_U8Length] != '\0')
+		{
+			LOC_U8Length++;
+		}
+		/* Queue the whole string or nothing of it */
+		if (LOC_U8Length > OUTPUT_QUEUE_SIZE - (u8)(GLOB_U8OutputHead - GLOB_U8OutputTail))
+		{
+			return ERROR;
+		}
+		for (u8 LOC_U8Index = 0; LOC_U8Index < LOC_U8Length; LOC_U8Index++)
+		{
+			LCD_U8Enqueue(LOC_U8String[LOC_U8Index], DATA_REGISTER);
+		}
+		return NO_ERROR;
+#elif TRANSPORT == I2C_TRANSPORT
+		/* Send the whole string in one I2C transaction */
+		LCD_U8BeginBurst();
+		for (u8 LOC_U8Index = 0; LOC_U8String[LOC_U8Index] != '\0'; LOC_U8Index++)
+		{
+			LCD_U8BurstByte(LOC_U8String[LOC_U8Index], DATA_REGISTER);
+		}
+		return LCD_U8EndBurst();
+#else
 		/* Send The String Character By Character */
 		for (u8 LOC_U8Index = 0; LOC_U8String[LOC_U8Index] != '\0'; LOC_U8Index++)
 		{
@@ -204,6 +607,7 @@ u8 LCD_U8SendString (const u8 *const LOC_U8String)
 		}
 
 		return NO_ERROR;
+#endif
 	}
 	else
 	{
@@ -351,3 +755,350 @@ u8 LCD_U8DrawExtraCharacter(const u8 *const LOC_U8Character)
 		return ERROR;
 	}
 }
+
+u8 LCD_U8FrameClear(void)
+{
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+	for (u8 LOC_U8Row = FIRST_ROW; LOC_U8Row < FRAME_ROWS; LOC_U8Row++)
+	{
+		for (u8 LOC_U8Column = FIRST_COLUMN; LOC_U8Column < FRAME_COLUMNS; LOC_U8Column++)
+		{
+			GLOB_AU8Frame[LOC_U8Row][LOC_U8Column] = BLANK_CHARACTER;
+		}
+	}
+	GLOB_U8FrameRow = FIRST_ROW;
+	GLOB_U8FrameColumn = FIRST_COLUMN;
+	return NO_ERROR;
+#else
+	return ERROR;
+#endif
+}
+
+u8 LCD_U8FrameSetPosition(const u8 LOC_U8Row, const u8 LOC_U8Column)
+{
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+	if (LOC_U8Row < FRAME_ROWS && LOC_U8Column < FRAME_COLUMNS)
+	{
+		GLOB_U8FrameRow = LOC_U8Row;
+		GLOB_U8FrameColumn = LOC_U8Column;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+#else
+	(void)LOC_U8Row;
+	(void)LOC_U8Column;
+	return ERROR;
+#endif
+}
+
+u8 LCD_U8FrameSendData(const u8 LOC_U8Data)
+{
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+	/* Characters beyond the end of the row are dropped */
+	if (GLOB_U8FrameColumn < FRAME_COLUMNS)
+	{
+		GLOB_AU8Frame[GLOB_U8FrameRow][GLOB_U8FrameColumn] = LOC_U8Data;
+		GLOB_U8FrameColumn++;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+#else
+	(void)LOC_U8Data;
+	return ERROR;
+#endif
+}
+
+u8 LCD_U8FrameSendString(const u8 *const LOC_U8String)
+{
+	if (LOC_U8String != NULL)
+	{
+		u8 LOC_U8Error = NO_ERROR;
+		for (u8 LOC_U8Index = 0; LOC_U8String[LOC_U8Index] != '\0' && NO_ERROR == LOC_U8Error; LOC_U8Index++)
+		{
+			LOC_U8Error = LCD_U8FrameSendData(LOC_U8String[LOC_U8Index]);
+		}
+		return LOC_U8Error;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8FrameFlush(void)
+{
+#if FRAMEBUFFER == ENABLE_FRAMEBUFFER
+	static const u8 LOC_AU8RowAddress[] = { FIRST_ROW_INITIAL_ADDRESS, SECOND_ROW_INITIAL_ADDRESS };
+	/* Where the address counter of the LCD points (not known before the first change) */
+	u8 LOC_U8Cursor = FRAME_NO_CURSOR;
+	u8 LOC_U8Error = NO_ERROR;
+	/* Stop at the first character that could not be sent */
+	for (u8 LOC_U8Row = FIRST_ROW; LOC_U8Row < FRAME_ROWS && NO_ERROR == LOC_U8Error; LOC_U8Row++)
+	{
+		/* Visit the columns in the order the address counter moves */
+		for (u8 LOC_U8Step = 0; LOC_U8Step < FRAME_COLUMNS && NO_ERROR == LOC_U8Error; LOC_U8Step++)
+		{
+			const u8 LOC_U8Column = FRAME_COLUMN(LOC_U8Step);
+			const u8 LOC_U8Character = GLOB_AU8Frame[LOC_U8Row][LOC_U8Column];
+			if (LOC_U8Character != GLOB_AU8Panel[LOC_U8Row][LOC_U8Column] || GLOB_U8FrameRedraw)
+			{
+				const u8 LOC_U8Address = DDRAM_ADDRESS_DB7 + LOC_AU8RowAddress[LOC_U8Row] + LOC_U8Column;
+#if TRANSPORT == I2C_TRANSPORT && OUTPUT_MODE == BLOCKING_OUTPUT
+				/* All the changes go in one I2C transaction */
+				if (FRAME_NO_CURSOR == LOC_U8Cursor)
+				{
+					LCD_U8BeginBurst();
+				}
+#endif
+				/* Set the DDRAM address only where a run of changed characters starts */
+				if (LOC_U8Address != LOC_U8Cursor)
+				{
+					LOC_U8Error = LCD_U8FrameSend(LOC_U8Address, COMMAND_REGISTER);
+				}
+				if (NO_ERROR == LOC_U8Error)
+				{
+					LOC_U8Error = LCD_U8FrameSend(LOC_U8Character, DATA_REGISTER);
+				}
+				GLOB_AU8Panel[LOC_U8Row][LOC_U8Column] = LOC_U8Character;
+				LOC_U8Cursor = LOC_U8Address + FRAME_ADDRESS_STEP;
+			}
+		}
+	}
+#if TRANSPORT == I2C_TRANSPORT && OUTPUT_MODE == BLOCKING_OUTPUT
+	if (FRAME_NO_CURSOR != LOC_U8Cursor)
+	{
+		LOC_U8Error = LCD_U8EndBurst();
+	}
+#endif
+	/* Send every character again next time if this flush did not reach the panel */
+	GLOB_U8FrameRedraw = ( NO_ERROR != LOC_U8Error );
+	return LOC_U8Error;
+#else
+	return ERROR;
+#endif
+}
+
+u8 LCD_U8FormatU8(const u8 LOC_U8Number, u8* const LOC_U8Buffer)
+{
+	if (LOC_U8Buffer != NULL)
+	{
+		LCD_U8FormatDigits16(LOC_U8Number, LOC_U8Buffer);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8FormatU16(const u16 LOC_U16Number, u8* const LOC_U8Buffer)
+{
+	if (LOC_U8Buffer != NULL)
+	{
+		LCD_U8FormatDigits16(LOC_U16Number, LOC_U8Buffer);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8FormatU32(const u32 LOC_U32Number, u8* const LOC_U8Buffer)
+{
+	if (LOC_U8Buffer != NULL)
+	{
+		LCD_U8FormatDigits(LOC_U32Number, 1, LOC_U8Buffer);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8FormatS32(const s32 LOC_S32Number, u8* const LOC_U8Buffer)
+{
+	if (LOC_U8Buffer != NULL)
+	{
+		u8 LOC_U8Length = 0;
+		/* Absolute value computed in unsigned arithmetic (valid for the most negative number too) */
+		u32 LOC_U32Magnitude = (u32)LOC_S32Number;
+		if (LOC_S32Number < 0)
+		{
+			LOC_U32Magnitude = 0 - LOC_U32Magnitude;
+			LOC_U8Buffer[LOC_U8Length++] = NEGATIVE_SIGN;
+		}
+		LCD_U8FormatDigits(LOC_U32Magnitude, 1, &LOC_U8Buffer[LOC_U8Length]);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8FormatFixedPoint(const s32 LOC_S32Number, const u8 LOC_U8FractionBits, u8* const LOC_U8Buffer)
+{
+#if FIXED_POINT_DECIMALS < 0 || FIXED_POINT_DECIMALS > MAX_FIXED_POINT_DECIMALS
+#error "Incorrect fixed-point numbers decimal digits"
+#endif
+	if (LOC_U8Buffer != NULL && LOC_U8FractionBits <= MAX_FRACTION_BITS)
+	{
+		u8 LOC_U8Length = 0;
+		u32 LOC_U32Magnitude = (u32)LOC_S32Number;
+		u32 LOC_U32Integer, LOC_U32Fraction, LOC_U32Scale = 1;
+		if (LOC_S32Number < 0)
+		{
+			LOC_U32Magnitude = 0 - LOC_U32Magnitude;
+		}
+		LOC_U32Integer = LOC_U32Magnitude >> LOC_U8FractionBits;
+		LOC_U32Fraction = LOC_U32Magnitude & ( ( (u32)1 << LOC_U8FractionBits ) - 1 );
+		/* Scale the fraction to the decimal digits (x10 as shifts and adds) */
+		for (u8 LOC_U8Decimal = 0; LOC_U8Decimal < FIXED_POINT_DECIMALS; LOC_U8Decimal++)
+		{
+			LOC_U32Fraction = ( LOC_U32Fraction << 3 ) + ( LOC_U32Fraction << 1 );
+			LOC_U32Scale = ( LOC_U32Scale << 3 ) + ( LOC_U32Scale << 1 );
+		}
+		/* Round to the nearest last decimal digit */
+		if (LOC_U8FractionBits != 0)
+		{
+			LOC_U32Fraction = ( LOC_U32Fraction + ( (u32)1 << ( LOC_U8FractionBits - 1 ) ) ) >> LOC_U8FractionBits;
+		}
+		if (LOC_U32Fraction == LOC_U32Scale)
+		{
+			LOC_U32Fraction = 0;
+			LOC_U32Integer++;
+		}
+		/* No sign for a number rounded to zero */
+		if (LOC_S32Number < 0 && ( LOC_U32Integer != 0 || LOC_U32Fraction != 0 ))
+		{
+			LOC_U8Buffer[LOC_U8Length++] = NEGATIVE_SIGN;
+		}
+		LOC_U8Length += LCD_U8FormatDigits(LOC_U32Integer, 1, &LOC_U8Buffer[LOC_U8Length]);
+#if FIXED_POINT_DECIMALS > 0
+		LOC_U8Buffer[LOC_U8Length++] = DECIMAL_POINT;
+		LCD_U8FormatDigits(LOC_U32Fraction, FIXED_POINT_DECIMALS, &LOC_U8Buffer[LOC_U8Length]);
+#else
+		LOC_U8Buffer[LOC_U8Length] = '\0';
+#endif
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8SendU8(const u8 LOC_U8Number)
+{
+	u8 LOC_AU8Text[LCD_NUMBER_BUFFER_SIZE];
+	LCD_U8FormatU8(LOC_U8Number, LOC_AU8Text);
+	return LCD_U8SendString(LOC_AU8Text);
+}
+
+u8 LCD_U8SendU16(const u16 LOC_U16Number)
+{
+	u8 LOC_AU8Text[LCD_NUMBER_BUFFER_SIZE];
+	LCD_U8FormatU16(LOC_U16Number, LOC_AU8Text);
+	return LCD_U8SendString(LOC_AU8Text);
+}
+
+u8 LCD_U8SendU32(const u32 LOC_U32Number)
+{
+	u8 LOC_AU8Text[LCD_NUMBER_BUFFER_SIZE];
+	LCD_U8FormatU32(LOC_U32Number, LOC_AU8Text);
+	return LCD_U8SendString(LOC_AU8Text);
+}
+
+u8 LCD_U8SendS32(const s32 LOC_S32Number)
+{
+	u8 LOC_AU8Text[LCD_NUMBER_BUFFER_SIZE];
+	LCD_U8FormatS32(LOC_S32Number, LOC_AU8Text);
+	return LCD_U8SendString(LOC_AU8Text);
+}
+
+u8 LCD_U8SendFixedPoint(const s32 LOC_S32Number, const u8 LOC_U8FractionBits)
+{
+	u8 LOC_AU8Text[LCD_NUMBER_BUFFER_SIZE];
+	if (NO_ERROR == LCD_U8FormatFixedPoint(LOC_S32Number, LOC_U8FractionBits, LOC_AU8Text))
+	{
+		return LCD_U8SendString(LOC_AU8Text);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 LCD_U8Tick(void)
+{
+#if OUTPUT_MODE == QUEUED_OUTPUT
+	u8 LOC_U8Error = NO_ERROR;
+#if TRANSPORT == I2C_TRANSPORT
+	/* The previous burst is still on the bus */
+	if (I2C_BUSY == GLOB_StrOutputTransaction.Status)
+	{
+		return NO_ERROR;
+	}
+	else if (I2C_COMPLETED != GLOB_StrOutputTransaction.Status)
+	{
+		/* Reported once */
+		GLOB_StrOutputTransaction.Status = I2C_COMPLETED;
+		LOC_U8Error = ERROR;
+	}
+#endif
+	if (GLOB_U16OutputWait != 0)
+	{
+		/* The LCD is still executing the last instruction */
+		GLOB_U16OutputWait--;
+	}
+	else if (GLOB_U8OutputHead != GLOB_U8OutputTail)
+	{
+		u8 LOC_U8Tail = GLOB_U8OutputTail;
+#if TRANSPORT == I2C_TRANSPORT
+		u16 LOC_U16Length = 0, LOC_U16Wait = 0;
+		/* Gather the queued bytes in one I2C transaction, up to a clear display or
+		 * return home instruction (the time to send a character covers the others)
+		 */
+		do
+		{
+			const u8 LOC_U8Byte = GLOB_AU8OutputByte[LOC_U8Tail & OUTPUT_QUEUE_MASK];
+			const u8 LOC_U8Register = GLOB_AU8OutputRegister[LOC_U8Tail & OUTPUT_QUEUE_MASK];
+			LCD_U8EncodeFrame(LOC_U8Byte, LOC_U8Register, &GLOB_AU8OutputFrame[LOC_U16Length]);
+			LOC_U16Length += BYTES_PER_CHARACTER;
+			LOC_U8Tail++;
+			if (COMMAND_REGISTER == LOC_U8Register && LOC_U8Byte < LONG_COMMAND_LIMIT)
+			{
+				/* Counted from the end of the transaction, which is between two ticks */
+				LOC_U16Wait = EXECUTION_TICKS(LONG_COMMAND_TIME_US) + 1;
+				break;
+			}
+		} while (LOC_U8Tail != GLOB_U8OutputHead && LOC_U16Length < sizeof(GLOB_AU8OutputFrame));
+		/* The bytes stay queued if the I2C queue is full */
+		if (NO_ERROR == I2C_U8MasterWriteReadAsync(&GLOB_StrOutputTransaction, EXPANDER_ADDRESS, GLOB_AU8OutputFrame, LOC_U16Length, NULL, 0))
+		{
+			GLOB_U8OutputTail = LOC_U8Tail;
+			GLOB_U16OutputWait = LOC_U16Wait;
+		}
+#else
+		const u8 LOC_U8Byte = GLOB_AU8OutputByte[LOC_U8Tail & OUTPUT_QUEUE_MASK];
+		const u8 LOC_U8Register = GLOB_AU8OutputRegister[LOC_U8Tail & OUTPUT_QUEUE_MASK];
+		/* One instruction or character per tick */
+		LCD_U8WriteByte(LOC_U8Byte, LOC_U8Register);
+		GLOB_U16OutputWait = ( COMMAND_REGISTER == LOC_U8Register && LOC_U8Byte < LONG_COMMAND_LIMIT ) ? \
+								EXECUTION_TICKS(LONG_COMMAND_TIME_US) : EXECUTION_TICKS(SHORT_COMMAND_TIME_US);
+		GLOB_U8OutputTail = LOC_U8Tail + 1;
+#endif
+	}
+	return LOC_U8Error;
+#else
+	return ERROR;
+#endif
+}
@@ -95,6 +95,24 @@ extern u8 DIO_U8SetPortValue (const u8 LOC_U8Port, const u8 LOC_U8Value);
 extern u8 DIO_U8SetPinValue (const u8 LOC_U8Port, const u8 LOC_U8Pin, const u8 LOC_U8Value);
 /**************************************************************************************/
 
+/**************************************************************************************/
+/* Description: Sets the pins of a port selected by a mask to either input or output  */
+/* in one write (the other pins are not changed)									  */
+/* Input      : Port - Mask - Direction (DIO_PORT_INPUT / DIO_PORT_OUTPUT)            */
+/* Output     : Error Checking                                                        */
+/**************************************************************************************/
+extern u8 DIO_U8SetMaskedPortDirection (const u8 LOC_U8Port, const u8 LOC_U8Mask, const u8 LOC_U8Direction);
+/**************************************************************************************/
+
+/**************************************************************************************/
+/* Description: Assigns the bits of a value selected by a mask to the pins of a port  */
+/* in one write (the other pins are not changed)									  */
+/* Input      : Port - Mask - Value	                                                  */
+/* Output     : Error Checking                                                        */
+/**************************************************************************************/
+extern u8 DIO_U8SetMaskedPortValue (const u8 LOC_U8Port, const u8 LOC_U8Mask, const u8 LOC_U8Value);
+/**************************************************************************************/
+
 /**************************************************************************************/
 /* Description: Toggles a certain pin				 		  						  */
 /* Input      : Port - Pin		                                                      */
@@ -8,6 +8,28 @@
 #ifndef _DIO_PRIVATE_H_
 #define _DIO_PRIVATE_H_
 
+/*************************************************************************************/
+/* 						  HOST SIMULATION REGISTERS									 */
+/* With HOST_SIMULATION defined, the registers are redirected to the I/O space of	 */
+/* the host model (SIM/TWI), which also drives the SCL and SDA pins of port C.		 */
+/*************************************************************************************/
+#ifdef HOST_SIMULATION
+#include "../../SIM/TWI/TWI_Interface.h"
+#define PORTA_REGISTER     	(&TWI_AU8IoSpace[0x3B])
+#define DDRA_REGISTER		(&TWI_AU8IoSpace[0x3A])
+#define PINA_REGISTER 		(&TWI_AU8IoSpace[0x39])
+#define PORTB_REGISTER 		(&TWI_AU8IoSpace[0x38])
+#define DDRB_REGISTER 		(&TWI_AU8IoSpace[0x37])
+#define PINB_REGISTER 		(&TWI_AU8IoSpace[0x36])
+#define PORTC_REGISTER 		(&TWI_AU8IoSpace[0x35])
+#define DDRC_REGISTER 		(&TWI_AU8IoSpace[0x34])
+#define PINC_REGISTER 		(&TWI_AU8IoSpace[0x33])
+#define PORTD_REGISTER 		(&TWI_AU8IoSpace[0x32])
+#define DDRD_REGISTER 		(&TWI_AU8IoSpace[0x31])
+#define PIND_REGISTER 		(&TWI_AU8IoSpace[0x30])
+/*************************************************************************************/
+#else
+
 /*************************************************************************************/
 /* 								GROUP A REGISTERS									 */
 /*************************************************************************************/
@@ -42,6 +64,7 @@
 #define DDRD_REGISTER 		((volatile u8*)0x31)
 #define PIND_REGISTER 		((volatile u8*)0x30)
 /*************************************************************************************/
+#endif
 
 
 /*************************************************************************************/
@@ -111,6 +111,45 @@ u8 DIO_U8SetPinValue (const u8 LOC_U8Port, const u8 LOC_U8Pin, const u8 LOC_U8Va
 	}
 }
 
+u8 DIO_U8SetMaskedPortDirection (const u8 LOC_U8Port, const u8 LOC_U8Mask, const u8 LOC_U8Direction)
+{
+	if (LOC_U8Port <= PORTD)
+	{
+		if (LOC_U8Direction == PORT_INPUT)
+		{
+			*directionRegisters[LOC_U8Port] &= ~LOC_U8Mask;
+			return NO_ERROR;
+		}
+		else if (LOC_U8Direction == PORT_OUTPUT)
+		{
+			*directionRegisters[LOC_U8Port] |= LOC_U8Mask;
+			return NO_ERROR;
+		}
+		else
+		{
+			return ERROR;
+		}
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 DIO_U8SetMaskedPortValue (const u8 LOC_U8Port, const u8 LOC_U8Mask, const u8 LOC_U8Value)
+{
+	if (LOC_U8Port <= PORTD)
+	{
+		/* One read-modify-write of the port register */
+		*writeRegisters[LOC_U8Port] = ( *writeRegisters[LOC_U8Port] & ~LOC_U8Mask ) | ( LOC_U8Value & LOC_U8Mask );
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
 u8 DIO_U8TogglePin (const u8 LOC_U8Port, const u8 LOC_U8Pin)
 {
 	if (LOC_U8Port <= PORTD && LOC_U8Pin <= PIN7)
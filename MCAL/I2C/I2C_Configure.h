@@ -44,4 +44,103 @@
 /*****************************************************************************/
 
 
+/*****************************************************************************/
+/*   TIMEOUT CONFIGURATION - NUMBER OF TIMES THE INTERRUPT FLAG IS POLLED    */
+/*   BEFORE A BLOCKING OPERATION GIVES UP - RANGE OF OPTIONS: 1 ~ 4294967295 */
+/*   (IT CAN BE CHANGED AT RUNTIME USING I2C_U8SetTimeout)                   */
+/*****************************************************************************/
+#define TIMEOUT_BUDGET							50000
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   TIMEOUT FLOOR CONFIGURATION - NUMBER OF BYTE TIMES AT THE CURRENT SCL   */
+/*   SPEED THAT A BLOCKING OPERATION WAITS AT LEAST, WHATEVER THE TIMEOUT    */
+/*   BUDGET (RECALCULATED WHENEVER THE SPEED CHANGES) - RANGE: 1 ~ 255       */
+/*****************************************************************************/
+#define TIMEOUT_BYTE_TIMES						4
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   ENGINE TIMEOUT CONFIGURATION - NUMBER OF CALLS TO I2C_U8MasterTick      */
+/*   WITHOUT ANY BUS EVENT BEFORE A SUBMITTED TRANSACTION IS ABORTED -       */
+/*   RANGE OF OPTIONS: 1 ~ 65535                                             */
+/*****************************************************************************/
+#define ENGINE_TIMEOUT_TICKS					10
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   TRANSACTION QUEUE SIZE - NUMBER OF SUBMITTED TRANSACTIONS THAT CAN WAIT */
+/*   FOR THE BUS - OPTIONS (POWERS OF TWO): 2 - 4 - 8 - 16 - 32 - 64 - 128   */
+/*****************************************************************************/
+#define QUEUE_SIZE								8
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   SLAVE FRAME QUEUE SIZE - NUMBER OF RECEIVED WRITES WHOSE END CAN BE     */
+/*   RECORDED IN THE SLAVE RECEIVE RING BEFORE THE APPLICATION CONSUMES      */
+/*   THEM - OPTIONS (POWERS OF TWO): 2 - 4 - 8 - 16 - 32 - 64 - 128          */
+/*****************************************************************************/
+#define FRAME_QUEUE_SIZE						8
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   ARBITRATION RETRIES - NUMBER OF TIMES A SUBMITTED TRANSACTION IS        */
+/*   REPLAYED FROM ITS START CONDITION AFTER LOSING ARBITRATION TO ANOTHER   */
+/*   MASTER - RANGE OF OPTIONS: 0 ~ 255                                      */
+/*****************************************************************************/
+#define ARBITRATION_RETRIES						3
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   BACKOFF WINDOW - MAXIMUM NUMBER OF CALLS TO I2C_U8MasterTick BEFORE A   */
+/*   TRANSACTION THAT LOST ARBITRATION IS REPLAYED. THE WAIT IS RANDOM AND   */
+/*   ITS WINDOW DOUBLES ON EVERY RETRY UP TO THIS VALUE. 0 REPLAYS AS SOON   */
+/*   AS THE BUS IS FREE (I2C_U8MasterTick IS NOT NEEDED) - RANGE: 0 ~ 255    */
+/*****************************************************************************/
+#define BACKOFF_WINDOW_TICKS					4
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*     		      OPTIONS FOR AUTOMATIC BUS RECOVERY ON TIMEOUT:				 */
+/*				ENABLE_BUS_RECOVERY - DISABLE_BUS_RECOVERY					 */
+/*****************************************************************************/
+#define BUS_RECOVERY							ENABLE_BUS_RECOVERY
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*     		      OPTIONS FOR THE BUS STATISTICS:							 */
+/*				ENABLE_STATISTICS - DISABLE_STATISTICS						 */
+/*   THE BUSY TIME IS MEASURED WITH TCNT1 (TIMER1 IS TO BE STARTED BY THE    */
+/*   APPLICATION, ITS CLOCK IS THE UNIT)                                     */
+/*****************************************************************************/
+#define STATISTICS								ENABLE_STATISTICS
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*     		      OPTIONS FOR THE BUS EVENT TRACE:							 */
+/*					ENABLE_TRACE - DISABLE_TRACE							 */
+/*   EVERY STATUS CODE SEEN BY THE DRIVER IS RECORDED WITH TWDR AND TCNT1    */
+/*   (TIMER1 IS TO BE STARTED BY THE APPLICATION, ITS CLOCK IS THE UNIT)     */
+/*****************************************************************************/
+#define TRACE									DISABLE_TRACE
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   TRACE SIZE - NUMBER OF EVENTS KEPT IN THE TRACE (THE OLDEST ONES ARE    */
+/*   OVERWRITTEN) - OPTIONS (POWERS OF TWO): 2 - 4 - 8 - 16 - 32 - 64 - 128  */
+/*****************************************************************************/
+#define TRACE_SIZE								32
+/*****************************************************************************/
+
+
 #endif /* MCAL_I2C_I2C_CONFIGURE_H_ */
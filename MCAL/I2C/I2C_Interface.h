@@ -24,6 +24,9 @@
 #define I2C_DATA_ERROR				8
 #define I2C_SENT_ACK				9
 #define I2C_SENT_NACK				10
+#define I2C_BUSY					11
+#define I2C_COMPLETED				12
+#define I2C_TIMEOUT					13
 /*************************************************************************************/
 
 
@@ -32,6 +35,143 @@
 /*************************************************************************************/
 #define I2C_SEND_ACK				1
 #define I2C_SEND_NACK				0
+#define I2C_PRESENCE_MAP_SIZE		16		/* Bytes of a map with a bit per address */
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		SCL SPEED PROFILE									 */
+/*************************************************************************************/
+/* Bit rate register value and prescaler bits that produce a certain SCL frequency.	 */
+/* A profile is computed once by I2C_U8ComputeSpeed and then applied whenever the	 */
+/* bus is used for a device that needs that frequency.								 */
+/*************************************************************************************/
+typedef struct
+{
+	u8 BitRate;
+	u8 Prescaler;
+} I2C_SpeedProfile;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  INTERRUPT-DRIVEN MASTER TRANSACTION						 */
+/*************************************************************************************/
+/* A complete master transaction that is executed by the I2C interrupt routine:		 */
+/* START - SLA+W - TxBuffer - REPEATED START - SLA+R - RxBuffer - STOP				 */
+/* The write phase is skipped if TxLength is 0 and the read phase is skipped if		 */
+/* RxLength is 0. If Speed is not NULL, the SCL frequency is switched to that		 */
+/* profile before the START condition. Status holds I2C_BUSY while the transaction	 */
+/* is on the bus and is then updated by the interrupt routine to I2C_COMPLETED or	 */
+/* to the error that ended the transaction. Retries counts the times the			 */
+/* transaction was replayed after losing arbitration.								 */
+/* If CallBack is not NULL, it is executed once when the transaction is finished,	 */
+/* with Context, the final status and the number of bytes transferred. It runs		 */
+/* from the interrupt routine (or from I2C_U8MasterIsBusy on a timeout) before the	 */
+/* next queued transaction is started, so it can submit follow-up transactions		 */
+/* (including the same descriptor) that go on the bus right after this one. It		 */
+/* should be short since the bus is held until it returns.							 */
+/*************************************************************************************/
+typedef struct
+{
+	u8 Address;
+	const I2C_SpeedProfile* Speed;
+	const u8* TxBuffer;
+	u16 TxLength;
+	u8* RxBuffer;
+	u16 RxLength;
+	volatile u8 Status;
+	volatile u16 Transferred;
+	volatile u8 Retries;
+	void (*CallBack)(void* Context, u8 Status, u16 Transferred);
+	void* Context;
+} I2C_Transaction;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		 DEVICE DESCRIPTOR									 */
+/*************************************************************************************/
+/* A slave device on the bus with its own SCL speed, retry policy, timeout budget	 */
+/* and statistics. It is filled by I2C_U8DeviceInit and then passed to the			 */
+/* I2C_U8Device* functions, which keep its statistics up to date. The failures		 */
+/* (Nacks to Errors) are counted per attempt; Acks and BusyTime are counted like	 */
+/* the bus statistics (see I2C_BusStats) but only for the device's own transfers,	 */
+/* and stay 0 if STATISTICS is disabled.											 */
+/*************************************************************************************/
+typedef struct
+{
+	u32 Transactions;
+	u32 BytesWritten;
+	u32 BytesRead;
+	u32 BusyTime;
+	u16 Retries;
+	u16 Acks;
+	u16 Nacks;
+	u16 ArbitrationLosses;
+	u16 AddressErrors;
+	u16 DataErrors;
+	u16 Timeouts;
+	u16 Errors;
+} I2C_DeviceStats;
+
+typedef struct
+{
+	u8 Address;
+	u8 MaxRetries;
+	u32 Timeout;
+	I2C_SpeedProfile Speed;
+	I2C_DeviceStats Stats;
+} I2C_Device;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		 BUS STATISTICS										 */
+/*************************************************************************************/
+/* Counters of the whole bus kept by the driver (see STATISTICS in					 */
+/* I2C_Configure.h) for the blocking functions and the interrupt routine alike:		 */
+/*  Transactions: START conditions sent (a transaction replayed after losing		 */
+/*   arbitration is counted again).													 */
+/*  BytesWritten / BytesRead: data bytes sent / received as master or slave.		 */
+/*  Acks / Nacks: ACK / NACK received for an address or data byte sent.			 */
+/*  ArbitrationLosses, Timeouts: as reported by the status values.				 */
+/*  AddressErrors / DataErrors: unexpected status codes after an address / data	 */
+/*   byte (including bus errors).													 */
+/*  BusyTime: TCNT1 ticks the node spent as master from the START condition to	 */
+/*   the last byte of each transaction. Two bus events of a transaction must be		 */
+/*   less than a timer period apart.												 */
+/* Utilization is the increase of BusyTime divided by the TCNT1 ticks elapsed.		 */
+/*************************************************************************************/
+typedef struct
+{
+	u32 Transactions;
+	u32 BytesWritten;
+	u32 BytesRead;
+	u32 Acks;
+	u32 Nacks;
+	u32 BusyTime;
+	u16 ArbitrationLosses;
+	u16 AddressErrors;
+	u16 DataErrors;
+	u16 Timeouts;
+} I2C_BusStats;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		  TRACE EVENT										 */
+/*************************************************************************************/
+/* A bus event recorded by the trace (see TRACE in I2C_Configure.h): the status		 */
+/* code, the contents of TWDR (the byte received or the last byte sent) and the		 */
+/* value of TCNT1 when the driver saw the event.									 */
+/*************************************************************************************/
+typedef struct
+{
+	u16 Time;
+	u8 Status;
+	u8 Data;
+} I2C_TraceEntry;
 /*************************************************************************************/
 
 
@@ -47,12 +187,58 @@
 extern u8 I2C_U8Init(void);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: computes the bit rate and prescaler that give the closest SCL		*/
+/* frequency not higher than the requested one, using the CPU clock frequency		*/
+/* F_CPU and the formula:															*/
+/* SCL FREQUENCY = CPU CLOCK FREQUENCY / (16 + (2 * BIT RATE * PRESCALER) )			*/
+/* The smallest prescaler is preferred and the bit rate is never set below 10.		*/
+/* Input: requested SCL frequency in Hz - pointer to a profile to receive the		*/
+/* result in - pointer to a variable to receive the achieved frequency in Hz in		*/
+/* Output: error checking (an error is returned if the frequency is not reachable)	*/
+/************************************************************************************/
+extern u8 I2C_U8ComputeSpeed(const u32 LOC_U32Frequency, I2C_SpeedProfile* const LOC_PtrProfile, u32* const LOC_U32Achieved);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: switches the SCL frequency to a previously computed profile. The	*/
+/* registers are only written if the profile differs from the one in use, once a	*/
+/* STOP condition still being sent is finished. This function should not be called	*/
+/* in the middle of a blocking transaction.											*/
+/* Input: pointer to the speed profile												*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running: its Speed member is used instead)										*/
+/************************************************************************************/
+extern u8 I2C_U8SetSpeed(const I2C_SpeedProfile* const LOC_PtrProfile);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: copies the profile in use, e.g. to be put back with I2C_U8SetSpeed	*/
+/* after the bus was used at another speed.											*/
+/* Input: pointer to a profile to receive the speed in use in						*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8GetSpeed(I2C_SpeedProfile* const LOC_PtrProfile);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: computes and applies the SCL frequency closest to the requested		*/
+/* one (see I2C_U8ComputeSpeed), overriding BIT_RATE and PRESCALER.					*/
+/* Input: requested SCL frequency in Hz - pointer to a variable to receive the		*/
+/* achieved frequency in Hz in														*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running)																			*/
+/************************************************************************************/
+extern u8 I2C_U8SetFrequency(const u32 LOC_U32Frequency, u32* const LOC_U32Achieved);
+/************************************************************************************/
+
 /************************************************************************************/
 /* Description: sends a start condition to start communication as a master. This	*/
 /* function can	be used whenever it is desired to be a master. 						*/
 /* Possible status that can be returned from function in variable LOC_U8Status:		*/
 /*  I2C_SENT_START: if start condition was transmitted successfully				*/
 /*  I2C_START_ERROR: if start condition was not transmitted successfully			*/
+/*  I2C_TIMEOUT: if the start condition was not transmitted in time.				*/
 /*																					*/
 /* Input: pointer to a variable to receive the status in	                        */
 /* Output: error checking		                                                    */
@@ -69,6 +255,7 @@ extern u8 I2C_U8MasterStart(u8* const LOC_U8Status);
 /*   successfully.																	*/
 /*  I2C_REPEATED_START_ERROR: if repeated start condition was not transmitted		*/
 /*   successfully																	*/
+/*  I2C_TIMEOUT: if the repeated start condition was not transmitted in time.		*/
 /*																					*/
 /* Input: pointer to a variable to receive the status in	                        */
 /* Output: error checking		                                                    */
@@ -83,6 +270,7 @@ extern u8 I2C_U8MasterRepeatedStart(u8* const LOC_U8Status);
 /*  I2C_RECEIVED_NACK: if the slave responded with a not acknowledge pulse.		*/
 /*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
 /*  I2C_ADDRESS_ERROR: if the address byte was not transmitted successfully		*/
+/*  I2C_TIMEOUT: if the address byte was not transmitted in time.					*/
 /*																					*/
 /* Input: address - pointer to a variable to receive the status in                  */
 /* Output: error checking		                                                    */
@@ -101,6 +289,7 @@ extern u8 I2C_U8MasterSendAddressWrite(const u8 LOC_U8Address, u8* const LOC_U8S
 /*   responded with a not acknowledge pulse.										*/
 /*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
 /*  I2C_DATA_ERROR: if the data byte was not transmitted successfully				*/
+/*  I2C_TIMEOUT: if the data byte was not transmitted within the timeout budget.	*/
 /*																					*/
 /* Input: data - pointer to a variable to receive the status in                  	*/
 /* Output: error checking		                                                    */
@@ -115,6 +304,7 @@ extern u8 I2C_U8MasterSendData (const u8 LOC_U8Data, u8* const LOC_U8Status);
 /*  I2C_RECEIVED_NACK: if the slave responded with a not acknowledge pulse.		*/
 /*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
 /*  I2C_ADDRESS_ERROR: if the address byte was not transmitted successfully		*/
+/*  I2C_TIMEOUT: if the address byte was not transmitted in time.					*/
 /*																					*/
 /* Input: address - pointer to a variable to receive the status in                  */
 /* Output: error checking		                                                    */
@@ -139,6 +329,7 @@ extern u8 I2C_U8MasterSendAddressRead(const u8 LOC_U8Address, u8* const LOC_U8St
 /*   sent.																			*/
 /*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
 /*  I2C_DATA_ERROR: if the data byte was not received successfully					*/
+/*  I2C_TIMEOUT: if the data byte was not received within the timeout budget.		*/
 /*																					*/
 /* Input: pointer to a variable to receive the data  in - ACK or NACK response -	*/
 /* pointer to a variable to receive the status in                  					*/
@@ -147,6 +338,77 @@ extern u8 I2C_U8MasterSendAddressRead(const u8 LOC_U8Address, u8* const LOC_U8St
 extern u8 I2C_U8MasterReceiveData (u8* const LOC_U8Data, const u8 LOC_U8Response, u8* const LOC_U8Status);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: sends a whole buffer of data bytes as a master in one call. This	*/
+/* function should be used after successfully pairing with a slave (i.e. sent the	*/
+/* slave's address with a write operation and the slave responded with an ACK		*/
+/* pulse). Transmission stops at the first byte that is not acknowledged.			*/
+/* The interrupt enable (TWIE) and acknowledge (TWEA) bits are kept as they are.	*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_RECEIVED_ACK: if all data bytes were transmitted and acknowledged.			*/
+/*  I2C_RECEIVED_NACK: if the slave responded to a data byte with a not			*/
+/*   acknowledge pulse.																*/
+/*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
+/*  I2C_DATA_ERROR: if a data byte was not transmitted successfully				*/
+/*  I2C_TIMEOUT: if a data byte was not transmitted within the timeout budget.		*/
+/*																					*/
+/* Input: pointer to the data - number of bytes - pointer to a variable to receive	*/
+/* the number of transmitted bytes in - pointer to a variable to receive the		*/
+/* status in																		*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8MasterWriteBuffer(const u8* const LOC_U8Data, const u16 LOC_U16Length, u16* const LOC_U16Count, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: receives a whole buffer of data bytes as a master in one call from	*/
+/* a previously addressed slave. Every data byte is answered with an ACK pulse		*/
+/* except the last one which is answered with a NACK pulse. The interrupt enable	*/
+/* bit (TWIE) is kept as it is and the acknowledge bit (TWEA) is put back after		*/
+/* the last byte.																	*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_SENT_NACK: if all data bytes were received successfully.					*/
+/*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
+/*  I2C_DATA_ERROR: if a data byte was not received successfully					*/
+/*  I2C_TIMEOUT: if a data byte was not received within the timeout budget.		*/
+/*																					*/
+/* Input: pointer to a buffer to receive the data in - number of bytes (at least	*/
+/* one) - pointer to a variable to receive the number of received bytes in -		*/
+/* pointer to a variable to receive the status in									*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8MasterReadBuffer(u8* const LOC_U8Data, const u16 LOC_U16Length, u16* const LOC_U16Count, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: executes a complete combined transaction as a master in one call:	*/
+/* START - SLA+W - write data - REPEATED START - SLA+R - read data - STOP			*/
+/* This is the usual way of writing a register pointer to a device and reading		*/
+/* the register contents back. The write phase is skipped if the number of bytes	*/
+/* to write is 0 and the read phase is skipped if the number of bytes to read is 0.	*/
+/* The interrupt enable (TWIE) and acknowledge (TWEA) bits are turned off during	*/
+/* the transaction (so the slave mode does not answer in the middle of it) and put	*/
+/* back with the STOP condition.													*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_COMPLETED: if all bytes were written and read successfully.				*/
+/*  I2C_START_ERROR: if the start condition was not transmitted successfully.		*/
+/*  I2C_REPEATED_START_ERROR: if the repeated start condition was not				*/
+/*   transmitted successfully.														*/
+/*  I2C_RECEIVED_NACK: if the slave responded to an address or a data byte with	*/
+/*   a not acknowledge pulse.														*/
+/*  I2C_ARBITRATION_LOST: if arbitration with another master was lost.				*/
+/*  I2C_ADDRESS_ERROR: if an address byte was not transmitted successfully.		*/
+/*  I2C_DATA_ERROR: if a data byte was not transmitted or received successfully.	*/
+/*  I2C_TIMEOUT: if the bus stopped responding within the timeout budget.			*/
+/*																					*/
+/* Input: address - pointer to the data to write - number of bytes to write -		*/
+/* pointer to a buffer to receive the read data in - number of bytes to read -		*/
+/* pointer to a variable to receive the status in									*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8MasterWriteRead(const u8 LOC_U8Address, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status);
+/************************************************************************************/
+
 /************************************************************************************/
 /* Description: sends a stop condition as a master.									*/
 /* Input: nothing																	*/
@@ -155,11 +417,40 @@ extern u8 I2C_U8MasterReceiveData (u8* const LOC_U8Data, const u8 LOC_U8Response
 extern u8 I2C_U8MasterStop(void);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: probes which devices are present on the bus by sending their		*/
+/* address with a write operation and noting whether it is acknowledged. All the	*/
+/* addresses are probed in one sequence without STOP conditions between them:		*/
+/* START - SLA+W - REPEATED START - SLA+W - ... - STOP								*/
+/* The result is kept in a presence map of I2C_PRESENCE_MAP_SIZE bytes, where		*/
+/* address A is bit (A % 8) of byte (A / 8). Only the probed addresses are			*/
+/* updated in it, so a later scan can probe only some addresses (e.g. the ones of	*/
+/* a connector whose device may have been plugged or unplugged) and find out which	*/
+/* of them changed. Addresses outside 0x01 ~ 0x77 are never probed. The interrupt	*/
+/* enable (TWIE) and acknowledge (TWEA) bits are turned off during the scan and		*/
+/* put back with the STOP condition.												*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/*  I2C_COMPLETED: if all the selected addresses were probed.						*/
+/*  I2C_START_ERROR, I2C_ARBITRATION_LOST, I2C_ADDRESS_ERROR, I2C_TIMEOUT: if the	*/
+/*   scan stopped before the end; the addresses probed so far are updated.			*/
+/*																					*/
+/* Input: pointer to the presence map - pointer to a map of the addresses to probe	*/
+/* (NULL to probe all of them) - pointer to a map to receive the addresses whose	*/
+/* presence changed in (NULL if not needed) - SCL frequency of the scan in Hz (e.g.	*/
+/* 400000; 0 to keep the current one, which is restored after the scan) - pointer	*/
+/* to a variable to receive the status in											*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running)																			*/
+/************************************************************************************/
+extern u8 I2C_U8MasterScan(u8* const LOC_U8Presence, const u8* const LOC_U8Select, u8* const LOC_U8Changed, const u32 LOC_U32Frequency, u8* const LOC_U8Status);
+/************************************************************************************/
+
 /************************************************************************************/
 /* Description: waits until being addressed by a master.							*/
 /* Possible status that can be returned from function in variable LOC_U8Status:		*/
 /*  I2C_SENT_ACK: if the slave was addressed and an ACK pulse was sent successfully*/
 /*  I2C_ADDRESS_ERROR: if the slave was not addressed successfully					*/
+/*  I2C_TIMEOUT: if no master addressed the slave within the timeout budget.		*/
 /*																					*/
 /* Input: pointer to a variable to receive the status in	                        */
 /* Output: error checking		                                                    */
@@ -182,6 +473,7 @@ extern u8 I2C_U8SlaveWaitForAddress(u8* const LOC_U8Status);
 /*  I2C_SENT_NACK: if the data byte was received successfully and a NACK pulse was	*/
 /*   sent.																			*/
 /*  I2C_DATA_ERROR: if the data byte was not received successfully					*/
+/*  I2C_TIMEOUT: if no data byte was received within the timeout budget.			*/
 /*																					*/
 /* Input: pointer to a variable to receive the data  in - ACK or NACK response -	*/
 /* pointer to a variable to receive the status in                  					*/
@@ -200,6 +492,7 @@ extern u8 I2C_U8SlaveReceiveData(u8* const LOC_U8Data, const u8 LOC_U8Response,
 /*  I2C_RECEIVED_NACK: if data was transmitted successfully and the master			*/
 /*   responded with a not acknowledge pulse.										*/
 /*  I2C_DATA_ERROR: if the data byte was not transmitted successfully				*/
+/*  I2C_TIMEOUT: if the data byte was not transmitted within the timeout budget.	*/
 /*																					*/
 /* Input: data - pointer to a variable to receive the status in                  	*/
 /* Output: error checking		                                                    */
@@ -207,6 +500,30 @@ extern u8 I2C_U8SlaveReceiveData(u8* const LOC_U8Data, const u8 LOC_U8Response,
 extern u8 I2C_U8SlaveSendData (const u8 LOC_U8Data, u8* const LOC_U8Status);
 /************************************************************************************/
 
+/************************************************************************************/
+/* Description: sets the number of times the interrupt flag is polled before a		*/
+/* blocking operation gives up and reports I2C_TIMEOUT (the initial value is		*/
+/* TIMEOUT_BUDGET in I2C_Configure.h). Whatever the budget, an operation waits at	*/
+/* least for TIMEOUT_BYTE_TIMES bytes at the current SCL speed.						*/
+/* Input: timeout budget (at least 1)												*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8SetTimeout(const u32 LOC_U32Budget);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: frees a bus that is held by a slave stuck in the middle of a byte.	*/
+/* The I2C peripheral is disabled, SCL is clocked through the DIO driver up to nine	*/
+/* times until the slave releases SDA, a STOP condition is generated and the		*/
+/* peripheral is enabled again. When BUS_RECOVERY is enabled in I2C_Configure.h		*/
+/* this function is called automatically whenever a master operation times out		*/
+/* (a slave operation only reports I2C_TIMEOUT and leaves the bus alone).			*/
+/* Input: nothing																	*/
+/* Output: error checking (an error is returned if SDA is still held low)			*/
+/************************************************************************************/
+extern u8 I2C_U8BusRecovery(void);
+/************************************************************************************/
+
 /************************************************************************************/
 /* Description: This function clears the I2C interrupt flag. These are the cases	*/
 /* where the I2C interrupt flag is fired:											*/
@@ -245,11 +562,297 @@ extern u8 I2C_U8DisableInterrupt(void);
 
 /***********************************************************************************/
 /* Description: takes a pointer to a function that is to be executed on		  	   */
-/* triggering the I2C interrupt.									 			   */
+/* triggering the I2C interrupt. While a transaction submitted by				   */
+/* I2C_U8MasterSubmit is running, the function is executed only once the		   */
+/* transaction is finished.														   */
 /* Inputs: pointer to a function that takes no arguments and returns no value	   */
 /* Output: error checking								  						   */
 /***********************************************************************************/
 extern u8 I2C_U8SetCallBack( void (*ptrToFun) (void) );
 /***********************************************************************************/
 
+/************************************************************************************/
+/* Description: submits a complete master transaction to be executed in the			*/
+/* background. If the bus is idle, the function only sends the START condition and	*/
+/* returns; the rest of the transaction (address bytes, data bytes, repeated start	*/
+/* and stop) is executed byte by byte from the I2C interrupt routine, so interrupts	*/
+/* must be enabled globally. If a transaction is already running, this one is put	*/
+/* in a queue of QUEUE_SIZE transactions and the interrupt routine starts it right	*/
+/* after the STOP condition of the previous one. The transaction descriptor must	*/
+/* stay valid until its status is no longer I2C_BUSY. Once a transaction is			*/
+/* finished, its own callback and then the callback set by I2C_U8SetCallBack (if	*/
+/* any) are executed from the interrupt routine. Transactions are to be submitted	*/
+/* from one place only (the main loop, a single interrupt routine or the			*/
+/* transaction callbacks).															*/
+/* A transaction that loses arbitration to another master (also while being		*/
+/* addressed as a slave by it) is replayed from its START condition up to			*/
+/* ARBITRATION_RETRIES times, after a random wait of up to BACKOFF_WINDOW_TICKS		*/
+/* calls to I2C_U8MasterTick.														*/
+/* Possible final status of the transaction in its Status member:					*/
+/*  I2C_COMPLETED: if all bytes were written and read successfully.				*/
+/*  I2C_START_ERROR: if the start condition was not transmitted successfully.		*/
+/*  I2C_REPEATED_START_ERROR: if the repeated start condition was not				*/
+/*   transmitted successfully.														*/
+/*  I2C_RECEIVED_NACK: if the slave responded to an address or a data byte with	*/
+/*   a not acknowledge pulse.														*/
+/*  I2C_ARBITRATION_LOST: if arbitration with another master was lost more times	*/
+/*   than ARBITRATION_RETRIES.														*/
+/*  I2C_ADDRESS_ERROR: if an address byte was not transmitted successfully.		*/
+/*  I2C_DATA_ERROR: if a data byte was not transmitted or received successfully.	*/
+/*  I2C_TIMEOUT: if the bus stopped responding (see I2C_U8MasterTick).				*/
+/*																					*/
+/* Input: pointer to the transaction descriptor										*/
+/* Output: error checking (an error is returned if the queue is full)				*/
+/************************************************************************************/
+extern u8 I2C_U8MasterSubmit(I2C_Transaction* const LOC_PtrTransaction);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: fills a transaction descriptor with a combined write-then-read		*/
+/* transaction and submits it to be executed in the background in the same way		*/
+/* as I2C_U8MasterSubmit. The Speed, CallBack and Context members of the			*/
+/* descriptor are left as they are.													*/
+/* Input: pointer to the transaction descriptor - address - pointer to the data to	*/
+/* write - number of bytes to write - pointer to a buffer to receive the read		*/
+/* data in - number of bytes to read												*/
+/* Output: error checking (an error is returned if the queue is full)				*/
+/************************************************************************************/
+extern u8 I2C_U8MasterWriteReadAsync(I2C_Transaction* const LOC_PtrTransaction, const u8 LOC_U8Address, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: supervises the transaction submitted by I2C_U8MasterSubmit. This	*/
+/* function is to be called periodically (e.g. from a timer interrupt routine).		*/
+/* If ENGINE_TIMEOUT_TICKS calls pass without any bus event, the transaction is		*/
+/* marked as timed out. It is then finished with I2C_TIMEOUT (and the bus is		*/
+/* recovered if BUS_RECOVERY is enabled) by the next call to I2C_U8MasterIsBusy,	*/
+/* so that this function stays short and never runs the bus recovery or the			*/
+/* transaction callbacks from a timer interrupt routine.							*/
+/* It also counts down the random wait of a transaction that lost arbitration		*/
+/* and then sends its START condition again.										*/
+/* Input: nothing																	*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8MasterTick(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: checks whether a submitted transaction is still running. A			*/
+/* transaction marked as timed out by I2C_U8MasterTick is finished here first (see	*/
+/* I2C_U8MasterTick), so this function is to be polled from the main context.		*/
+/* Input: pointer to a variable to receive 1 if busy or 0 if idle					*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8MasterIsBusy(u8* const LOC_U8Busy);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: initializes a device descriptor: computes its speed profile (see	*/
+/* I2C_U8ComputeSpeed) and clears its statistics.									*/
+/* Input: pointer to the device descriptor - address - SCL frequency in Hz -		*/
+/* number of times a failed transaction is retried - timeout budget of the			*/
+/* device's blocking operations (0 to use TIMEOUT_BUDGET)							*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8DeviceInit(I2C_Device* const LOC_PtrDevice, const u8 LOC_U8Address, const u32 LOC_U32Frequency, const u8 LOC_U8MaxRetries, const u32 LOC_U32Timeout);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes a buffer to a device in a complete transaction				*/
+/* (START - SLA+W - data - STOP) at the device's speed and with its timeout,		*/
+/* retrying it up to the device's maximum number of retries.						*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/* the same as I2C_U8MasterWriteRead (of the last attempt).							*/
+/*																					*/
+/* Input: pointer to the device descriptor - pointer to the data - number of		*/
+/* bytes - pointer to a variable to receive the status in							*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running). The speed that was set before the call is restored.					*/
+/************************************************************************************/
+extern u8 I2C_U8DeviceWrite(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads a buffer from a device in a complete transaction				*/
+/* (START - SLA+R - data - STOP) at the device's speed and with its timeout,		*/
+/* retrying it up to the device's maximum number of retries.						*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/* the same as I2C_U8MasterWriteRead (of the last attempt).							*/
+/*																					*/
+/* Input: pointer to the device descriptor - pointer to a buffer to receive the		*/
+/* data in - number of bytes - pointer to a variable to receive the status in		*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running). The speed that was set before the call is restored.					*/
+/************************************************************************************/
+extern u8 I2C_U8DeviceRead(I2C_Device* const LOC_PtrDevice, u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: writes then reads a device in a combined transaction (see			*/
+/* I2C_U8MasterWriteRead) at the device's speed and with its timeout, retrying it	*/
+/* up to the device's maximum number of retries.									*/
+/* Possible status that can be returned from function in variable LOC_U8Status:		*/
+/* the same as I2C_U8MasterWriteRead (of the last attempt).							*/
+/*																					*/
+/* Input: pointer to the device descriptor - pointer to the data to write -			*/
+/* number of bytes to write - pointer to a buffer to receive the read data in -		*/
+/* number of bytes to read - pointer to a variable to receive the status in			*/
+/* Output: error checking (an error is returned while a submitted transaction is	*/
+/* running). The speed that was set before the call is restored.					*/
+/************************************************************************************/
+extern u8 I2C_U8DeviceWriteRead(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: clears the statistics of a device.									*/
+/* Input: pointer to the device descriptor											*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8DeviceResetStats(I2C_Device* const LOC_PtrDevice);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: copies the bus statistics. The copy is consistent even if the		*/
+/* interrupt routine updates them in the meantime.									*/
+/* Input: pointer to a structure to receive the statistics in						*/
+/* Output: error checking (an error is returned if STATISTICS is disabled)			*/
+/************************************************************************************/
+extern u8 I2C_U8GetBusStats(I2C_BusStats* const LOC_PtrStats);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: clears the bus statistics.											*/
+/* Input: nothing																	*/
+/* Output: error checking (an error is returned if STATISTICS is disabled)			*/
+/************************************************************************************/
+extern u8 I2C_U8ResetBusStats(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: starts the interrupt-driven slave mode. The slave answers its own	*/
+/* address (and the general call if enabled) from the I2C interrupt routine like a	*/
+/* device with a register file, using a register map owned by the application:		*/
+/*  Write: the first data byte sets the register pointer and the following bytes	*/
+/*   are stored in the map from the pointer on.										*/
+/*  Read: the bytes of the map are sent from the register pointer on.				*/
+/* The pointer is incremented after every byte and wraps at the end of the map.		*/
+/* The master is never kept waiting: every byte is acknowledged and the byte to		*/
+/* send is loaded as soon as the slave is addressed for a read. The function		*/
+/* passed (if not NULL) is executed from the interrupt routine once a write that	*/
+/* stored data in the map is ended by a STOP or a REPEATED START condition, with	*/
+/* the first register written and the number of bytes written.						*/
+/* Interrupts must be enabled globally. Transactions submitted by					*/
+/* I2C_U8MasterSubmit keep working in slave mode, but the blocking master and		*/
+/* slave functions are not to be used while it is on.								*/
+/* Input: pointer to the register map - size of the map (1 to 256) - pointer to		*/
+/* the write notification function													*/
+/* Output: error checking (an error is returned if a transaction is running)		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveRegisterMap(u8* const LOC_U8Registers, const u16 LOC_U16Size, void (*ptrToFun) (u16 LOC_U16Register, u16 LOC_U16Length));
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: starts the interrupt-driven slave mode (see I2C_U8SlaveRegisterMap)	*/
+/* with the data written by the masters stored in a ring buffer owned by the		*/
+/* application instead of a register map. Every data byte is stored in the ring	*/
+/* from the interrupt routine and the end of every write (STOP or REPEATED START)	*/
+/* is recorded as a frame boundary, up to FRAME_QUEUE_SIZE frames. The data is		*/
+/* then consumed in place with I2C_U8SlavePeek and I2C_U8SlaveCommit. When the		*/
+/* ring (or the frame queue) is full, the slave holds SCL low until the				*/
+/* application commits some data, so no byte is ever lost. If a register map is		*/
+/* set, it still answers the reads of the masters (0xFF is sent otherwise).			*/
+/* Input: pointer to the ring buffer - size of the ring (a power of two from 2 to	*/
+/* 256, one byte of it is kept free)												*/
+/* Output: error checking (an error is returned if a transaction is running)		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveReceiveRing(u8* const LOC_U8Buffer, const u16 LOC_U16Size);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: gets the received data that is waiting in the ring as one			*/
+/* contiguous span inside the ring buffer, without copying it. The span stops at	*/
+/* the end of the ring buffer and at the end of the oldest frame, so the rest of	*/
+/* the data is returned by the next calls once this span is committed. The span		*/
+/* can be empty with the frame end flag set if the whole frame was consumed			*/
+/* before its end was received.														*/
+/* Input: pointer to a variable to receive the address of the span in - pointer to	*/
+/* a variable to receive its length in (0 if there is no data) - pointer to a		*/
+/* variable to receive 1 in if the span ends a frame or 0 otherwise					*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 I2C_U8SlavePeek(const u8** const LOC_PtrData, u16* const LOC_U16Length, u8* const LOC_U8FrameEnd);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: frees the first bytes of the span returned by I2C_U8SlavePeek so	*/
+/* that the slave can store new data in their place. Committing the whole span of	*/
+/* a frame end (0 bytes included) also consumes the frame boundary.					*/
+/* Input: number of bytes consumed													*/
+/* Output: error checking (an error is returned if more bytes than the span are		*/
+/* committed)																		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveCommit(const u16 LOC_U16Length);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: starts the interrupt-driven slave mode (see I2C_U8SlaveRegisterMap)	*/
+/* with the reads of the masters answered from a buffer owned by the application	*/
+/* instead of the register map. Every read sends the buffer from its first byte:	*/
+/* the interrupt routine loads the next byte as soon as the previous one is			*/
+/* acknowledged, and the last byte of the buffer is sent as the last byte of the	*/
+/* transfer (0xFF follows if the master reads more). The buffer must stay valid		*/
+/* while the slave mode is on. Without a register map or a receive ring, the first	*/
+/* data byte of a write is answered with NACK and dropped.							*/
+/* Input: pointer to the data - number of bytes (at least 1)						*/
+/* Output: error checking (an error is returned if a transaction is running)		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveTransmitBuffer(const u8* const LOC_U8Data, const u16 LOC_U16Length);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: starts the interrupt-driven slave mode (see I2C_U8SlaveRegisterMap)	*/
+/* with the reads of the masters answered by a producer function instead of the		*/
+/* register map. The producer is executed from the interrupt routine whenever a		*/
+/* byte is to be loaded (on being addressed for a read and after every byte the		*/
+/* master acknowledges). It stores the next byte in its argument and returns 1, or	*/
+/* returns 0 if it has nothing more to send, in which case 0xFF is sent as the		*/
+/* last byte of the transfer. The producer must be short. Passing NULL removes the	*/
+/* producer (and a buffer set by I2C_U8SlaveTransmitBuffer) so that the register	*/
+/* map answers the reads again. Without a register map or a receive ring, the first	*/
+/* data byte of a write is answered with NACK and dropped.							*/
+/* Input: pointer to the producer function											*/
+/* Output: error checking (an error is returned if a transaction is running)		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveTransmitProducer( u8 (*ptrToFun) (u8* const LOC_U8Data) );
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: passes the events kept in the trace to a function, from the oldest	*/
+/* to the newest one, e.g. to print them. The time between two events is the		*/
+/* difference of their Time members (modulo 65536). Events recorded while the		*/
+/* dump is in progress may replace the oldest ones, so it is better done while		*/
+/* the bus is idle.																	*/
+/* Input: pointer to a function that takes a pointer to an event					*/
+/* Output: error checking (an error is returned if TRACE is disabled)				*/
+/************************************************************************************/
+extern u8 I2C_U8TraceDump( void (*ptrToFun) (const I2C_TraceEntry* const LOC_PtrEntry) );
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: empties the trace.													*/
+/* Input: nothing																	*/
+/* Output: error checking (an error is returned if TRACE is disabled)				*/
+/************************************************************************************/
+extern u8 I2C_U8TraceClear(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: stops the interrupt-driven slave mode: the slave address is no		*/
+/* longer acknowledged.																*/
+/* Input: nothing																	*/
+/* Output: error checking (an error is returned if a transaction is running)		*/
+/************************************************************************************/
+extern u8 I2C_U8SlaveDisable(void);
+/************************************************************************************/
+
 #endif /* MCAL_I2C_I2C_INTERFACE_H_ */
@@ -11,12 +11,36 @@
 
 /***********************************************************************************/
 /*  							  REGISTERS ADDRESSES							   */
-/***********************************************************************************/
+/* With HOST_SIMULATION defined, the registers are redirected to the host model of */
+/* the peripheral (SIM/TWI) so that the driver can run on a Linux host.			   */
+/***********************************************************************************/
+#ifdef HOST_SIMULATION
+#include "../../SIM/TWI/TWI_Interface.h"
+#define TWCR_REGISTER 								(*TWI_PtrRegister(0x56))
+#define TWDR_REGISTER 								(*TWI_PtrRegister(0x23))
+#define TWAR_REGISTER 								(*TWI_PtrRegister(0x22))
+#define TWSR_REGISTER 								(*TWI_PtrRegister(0x21))
+#define TWBR_REGISTER 								(*TWI_PtrRegister(0x20))
+#define TWINT_FLAG									TWI_U8Flag()
+#define TCNT1_REGISTER								TWI_U16Timer()
+#define SREG_REGISTER 								(*TWI_PtrRegister(0x5F))
+#else
 #define TWCR_REGISTER 								*((volatile u8*)0x56)
 #define TWDR_REGISTER 								*((volatile u8*)0x23)
 #define TWAR_REGISTER 								*((volatile u8*)0x22)
 #define TWSR_REGISTER 								*((volatile u8*)0x21)
 #define TWBR_REGISTER 								*((volatile u8*)0x20)
+#define TWINT_FLAG									GET_BIT(TWCR_REGISTER, TWINT)
+#define TCNT1_REGISTER								*((volatile u16*)0x4C)
+#define SREG_REGISTER 								*((volatile u8*)0x5F)
+#endif
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					              SREG REGISTER BITS							   */
+/***********************************************************************************/
+#define SREG_I										7
 /***********************************************************************************/
 
 
@@ -59,6 +83,26 @@
 /* 					                  BIT RATE RANGE						   	   */
 /***********************************************************************************/
 #define MINIMUM_BIT_RATE							10
+#define MAXIMUM_BIT_RATE							255
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					               SCL FREQUENCY FORMULA					   	   */
+/* SCL FREQUENCY = CPU CLOCK FREQUENCY / (16 + (2 * BIT RATE * PRESCALER) )		   */
+/***********************************************************************************/
+#define SCL_FIXED_CYCLES							16
+#define SCL_BIT_RATE_FACTOR							2
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					               TIMEOUT FLOOR							   	   */
+/* POLLS PER BYTE = BITS PER BYTE * CYCLES PER SCL PERIOD / CYCLES PER POLL	   	   */
+/* (A POLL TAKES AT LEAST POLL_LOOP_CYCLES, SO THE FLOOR ERRS ON THE LONG SIDE)	   */
+/***********************************************************************************/
+#define BITS_PER_BYTE								9
+#define POLL_LOOP_CYCLES							4
 /***********************************************************************************/
 
 
@@ -69,6 +113,8 @@
 #define PRESCALER_4									4
 #define PRESCALER_16								16
 #define PRESCALER_64								64
+#define PRESCALER_OPTIONS							4
+#define MASK_PRESCALER_SELECT_BITS					0x03
 /***********************************************************************************/
 
 
@@ -77,6 +123,27 @@
 /***********************************************************************************/
 #define MINIMUM_ADDRESS								0x01
 #define MAXIMUM_ADDRESS								0x77
+#define PRESENCE_BYTE_SHIFT							3
+#define PRESENCE_BIT_MASK							0x07
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  BUS RECOVERY								   */
+/***********************************************************************************/
+#define ENABLE_BUS_RECOVERY							0
+#define DISABLE_BUS_RECOVERY						1
+#define SCL_PORT									DIO_PORTC
+#define SCL_PIN										DIO_PIN0
+#define SDA_PORT									DIO_PORTC
+#define SDA_PIN										DIO_PIN1
+#define RECOVERY_CLOCK_PULSES						9
+#define RECOVERY_HALF_PERIOD_US						5
+#define TWCR_DISABLED								0
+#define TWCR_ENABLED								( 1 << TWEN )
+/* Side of the bus a blocking wait is done for (only a master recovers the bus) */
+#define ROLE_MASTER									0
+#define ROLE_SLAVE									1
 /***********************************************************************************/
 
 
@@ -91,6 +158,7 @@
 /***********************************************************************************/
 /* 					           		STATUS CODES						   		   */
 /***********************************************************************************/
+#define BUS_ERROR_STATUS							0x00
 #define START_STATUS								0x08
 #define REPEATED_START_STATUS						0x10
 #define ADDRESS_WRITE_ACK_STATUS					0x18
@@ -110,11 +178,13 @@
 #define GC_ADDRESSED_ACK_DATA_STATUS				0x90
 #define SLA_ADDRESSED_NACK_DATA_STATUS				0x88
 #define GC_ADDRESSED_NACK_DATA_STATUS				0x98
+#define SLAVE_STOP_STATUS							0xA0
 #define SLA_ADDRESSED_READ_ACK_STATUS				0xA8
 #define LOST_SLA_ADDRESSED_READ_STATUS				0xB0
 #define SLAVE_SENT_ACK_STATUS						0xB8
 #define SLAVE_SENT_NACK_STATUS						0xC0
 #define SLAVE_LAST_DATA_ACK_STATUS					0xC8
+#define NO_INFO_STATUS								0xF8
 /***********************************************************************************/
 
 
@@ -132,6 +202,9 @@
 #define DATA_ERROR				8
 #define SENT_ACK				9
 #define SENT_NACK				10
+#define BUSY					11
+#define COMPLETED				12
+#define TIMEOUT					13
 /*************************************************************************************/
 
 
@@ -143,20 +216,234 @@
 /*************************************************************************************/
 
 
+/***********************************************************************************/
+/* 					   TWCR VALUES USED BY THE TRANSACTION ENGINE					   */
+/***********************************************************************************/
+#define TWCR_START				( (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_SEND				( (1 << TWINT) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_RECEIVE_ACK		( (1 << TWINT) | (1 << TWEA) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_RECEIVE_NACK		( (1 << TWINT) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_STOP				( (1 << TWINT) | (1 << TWSTO) | (1 << TWEN) )
+#define TWCR_RELEASE			( (1 << TWINT) | (1 << TWEN) )
+#define TWCR_CHAIN				( (1 << TWSTA) | (1 << TWIE) )
+/* START requested from main context: TWINT is not written so that a pending slave event is kept */
+#define TWCR_REQUEST_START		( (1 << TWSTA) | (1 << TWEN) | (1 << TWIE) )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					   TWCR VALUES USED BY THE BURST FUNCTIONS					   */
+/***********************************************************************************/
+#define TWCR_TRANSFER			( (1 << TWINT) | (1 << TWEN) )
+#define TWCR_TRANSFER_ACK		( (1 << TWINT) | (1 << TWEA) | (1 << TWEN) )
+#define TWCR_TRANSFER_START		( (1 << TWINT) | (1 << TWSTA) | (1 << TWEN) )
+/* Interrupt enable and own address acknowledge bits set by the application, put back by the burst functions */
+#define TWCR_KEEP_MASK			( (1 << TWEA) | (1 << TWIE) )
+#define TWCR_KEEP_INTERRUPT		( 1 << TWIE )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					   TWCR VALUES USED BY THE SLAVE ENGINE						   */
+/***********************************************************************************/
+#define TWCR_SLAVE_ACK			( (1 << TWINT) | (1 << TWEA) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_SLAVE_LAST			( (1 << TWINT) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_SLAVE_RECOVER		( (1 << TWINT) | (1 << TWSTO) | (1 << TWEA) | (1 << TWEN) | (1 << TWIE) )
+#define TWCR_SLAVE_LISTEN		( (1 << TWEA) | (1 << TWIE) )
+#define TWCR_PENDING_START		( 1 << TWSTA )
+#define TWCR_SLAVE_STALL		( (1 << TWEA) | (1 << TWEN) )
+#define TWCR_SLAVE_RESUME		( (1 << TWEA) | (1 << TWEN) | (1 << TWIE) )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           STATUS TABLE DEFINITIONS						   */
+/***********************************************************************************/
+/* Every status code is a multiple of 8, so shifting it by 3 gives a unique index  */
+/* in a table of 32 entries.													   */
+/***********************************************************************************/
+#define STATUS_TABLE_SIZE							32
+#define STATUS_INDEX_SHIFT							3
+#define STATUS_INDEX(status)						( (status) >> STATUS_INDEX_SHIFT )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 			  STATUS CLASSES - THE OPERATION THAT PRODUCES A STATUS CODE		   */
+/***********************************************************************************/
+#define CLASS_NONE									0
+#define CLASS_START									1
+#define CLASS_REPEATED_START						2
+#define CLASS_ADDRESS_WRITE							3
+#define CLASS_DATA_WRITE							4
+#define CLASS_ADDRESS_READ							5
+#define CLASS_DATA_READ								6
+#define CLASS_ARBITRATION							7
+#define CLASS_SLAVE_ADDRESS							8
+#define CLASS_SLAVE_RECEIVE							9
+#define CLASS_SLAVE_STOP							10
+#define CLASS_SLAVE_TRANSMIT						11
+#define CLASS_BUS_ERROR								12
+#define CLASS_TIMEOUT								13
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 			  STATUS ACTIONS - WHAT THE INTERRUPT ROUTINE DOES NEXT				   */
+/***********************************************************************************/
+#define ACTION_UNEXPECTED							0
+#define ACTION_SEND_ADDRESS							1
+#define ACTION_SEND_DATA							2
+#define ACTION_DATA_ACKED							3
+#define ACTION_DATA_NACKED							4
+#define ACTION_ADDRESS_NACKED						5
+#define ACTION_START_READ							6
+#define ACTION_READ_DATA							7
+#define ACTION_READ_LAST							8
+#define ACTION_ARBITRATION_LOST						9
+#define ACTION_SLAVE_RECEIVE_START					10
+#define ACTION_SLAVE_RECEIVE_START_LOST				11
+#define ACTION_SLAVE_RECEIVE_DATA					12
+#define ACTION_SLAVE_RECEIVE_LAST					13
+#define ACTION_SLAVE_STOP							14
+#define ACTION_SLAVE_TRANSMIT_START					15
+#define ACTION_SLAVE_TRANSMIT_START_LOST			16
+#define ACTION_SLAVE_TRANSMIT_DATA					17
+#define ACTION_SLAVE_TRANSMIT_END					18
+#define ACTION_BUS_ERROR							19
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  STATUS TABLE ENTRY							   */
+/***********************************************************************************/
+typedef struct
+{
+	u8 Outcome;		/* Operation status reported to the application		*/
+	u8 Class;		/* Operation that produces the status code			*/
+	u8 Action;		/* Next step of the interrupt routine				*/
+	u8 Counters;	/* Bus statistics counted for the status code		*/
+} I2C_StatusEntry;
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  TRANSACTION QUEUE								   */
+/***********************************************************************************/
+#define QUEUE_MASK									( QUEUE_SIZE - 1 )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           TRANSACTION ENGINE PHASES						   */
+/***********************************************************************************/
+#define PHASE_START				0
+#define PHASE_REPEATED_START	1
+#define PHASE_ADDRESS			2
+#define PHASE_DATA				3
+#define PHASE_BACKOFF			4
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  SLAVE REGISTER MAP							   */
+/***********************************************************************************/
+#define MAXIMUM_MAP_SIZE							256
+#define SLAVE_IDLE_BYTE								0xFF
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  SLAVE RECEIVE RING							   */
+/* One slot of the ring is kept empty to tell a full ring from an empty one.	   */
+/***********************************************************************************/
+#define MINIMUM_RING_SIZE							2
+#define MAXIMUM_RING_SIZE							256
+#define FRAME_QUEUE_MASK							( FRAME_QUEUE_SIZE - 1 )
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  ARBITRATION BACKOFF							   */
+/* Random waits come from a 16-bit Galois LFSR seeded with the own slave address,  */
+/* so that two masters on the same bus draw different sequences.				   */
+/***********************************************************************************/
+#define RANDOM_TAPS									0xB400
+#define RANDOM_SEED									0xACE1
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  	 BUS STATISTICS								   */
+/***********************************************************************************/
+#define ENABLE_STATISTICS							0
+#define DISABLE_STATISTICS							1
+#define COUNT_NONE									0x00
+#define COUNT_TRANSACTION							0x01
+#define COUNT_WRITTEN								0x02
+#define COUNT_READ									0x04
+#define COUNT_ACK									0x08
+#define COUNT_NACK									0x10
+#define COUNT_LOST									0x20
+#define COUNT_BUSY									0x40
+#if ENABLE_STATISTICS == STATISTICS
+#define COUNT_EVENT(counter)						I2C_VidCountEvent(&GLOB_StrBusStats.counter)
+#else
+#define COUNT_EVENT(counter)
+#endif
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	  	 BUS EVENT TRACE							   */
+/***********************************************************************************/
+#define ENABLE_TRACE								0
+#define DISABLE_TRACE								1
+#define TRACE_MASK									( TRACE_SIZE - 1 )
+/***********************************************************************************/
+
+
 /***********************************************************************************/
 /* 					           	   OTHER DEFINITIONS							   */
 /***********************************************************************************/
 #define SHIFT_BY_ONE								1
 #define MASK_PRESCALER_BITS							0xF8
+#define READ_OPERATION								1
+#define WRITE_OPERATION								0
 /***********************************************************************************/
 
 
 /***********************************************************************************/
 /* 							  PRIVATE FUNCTIONS PROTOTYPE 						   */
 /***********************************************************************************/
+#ifdef HOST_SIMULATION
+void __vector_19(void);
+#else
 void __vector_19(void) __attribute__((signal));
+#endif
 static u8 I2C_U8StartConditionSequence(void);
-static u8 I2C_U8InfoSequence(void);
+static u8 I2C_U8InfoSequence(const u8 LOC_U8Role);
+static u8 I2C_U8WaitSequence(const u8 LOC_U8Role);
+static u8 I2C_U8DeviceTransfer(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status);
+static u8 I2C_U8DecodeStatus(const u8 LOC_U8Event, const u8 LOC_U8Class, const u8 LOC_U8Error);
+static u8 I2C_U8TransferSequence(const u8 LOC_U8Control);
+static void I2C_VidMasterEngine(const I2C_StatusEntry* const LOC_PtrEntry);
+static u8 I2C_U8SlaveEngine(const I2C_StatusEntry* const LOC_PtrEntry);
+static void I2C_VidSlaveListen(void);
+static void I2C_VidFinishTransaction(const u8 LOC_U8Status, const u8 LOC_U8Control);
+static void I2C_VidPrepareTransaction(I2C_Transaction* const LOC_PtrTransaction);
+static void I2C_VidServiceTimeout(void);
+static u8 I2C_U8WriteSpeed(const I2C_SpeedProfile* const LOC_PtrProfile);
+static void I2C_VidUpdateTimeoutFloor(void);
+static void I2C_VidArbitrationLost(const u8 LOC_U8Control);
+static u8 I2C_U8BackoffTicks(const u8 LOC_U8Attempt);
+#if ENABLE_STATISTICS == STATISTICS
+static u16 I2C_U16Count(const I2C_StatusEntry* const LOC_PtrEntry);
+static void I2C_VidCountEvent(u16* const LOC_PtrCounter);
+#endif
+#if ENABLE_TRACE == TRACE
+static void I2C_VidTrace(const u8 LOC_U8Status);
+#endif
 /***********************************************************************************/
 
 
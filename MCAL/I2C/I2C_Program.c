@@ -10,11 +10,129 @@
 #include "../../LIB/STD_TYPES.h"
 #include "../../LIB/BIT_MATH.h"
 /* MCAL LAYER */
+#include "../DIO/DIO_Interface.h"
+#include "I2C_Interface.h"
 #include "I2C_Configure.h"
 #include "I2C_Private.h"
+/* DELAY LIBRARY (PROVIDED BY THE HOST MODEL IN A HOST BUILD) */
+#ifndef HOST_SIMULATION
+#include <util/delay.h>
+#endif
 
 void (*GLOB_VidI2CPtrCallBack)(void) = NULL;
 
+/* Outcome, class, next action and counters of every status code, indexed by TWSR >> 3.
+ * Codes that are not listed are left as CLASS_NONE - ACTION_UNEXPECTED - COUNT_NONE.
+ */
+static const I2C_StatusEntry GLOB_AStrStatusTable[STATUS_TABLE_SIZE] =
+{
+	[STATUS_INDEX(BUS_ERROR_STATUS)]				= { DATA_ERROR,				CLASS_BUS_ERROR,		ACTION_BUS_ERROR,					COUNT_NONE },
+	[STATUS_INDEX(START_STATUS)]					= { SENT_START,				CLASS_START,			ACTION_SEND_ADDRESS,				COUNT_TRANSACTION },
+	[STATUS_INDEX(REPEATED_START_STATUS)]			= { SENT_REPEATED_START,	CLASS_REPEATED_START,	ACTION_SEND_ADDRESS,				COUNT_BUSY },
+	[STATUS_INDEX(ADDRESS_WRITE_ACK_STATUS)]		= { RECEIVED_ACK,			CLASS_ADDRESS_WRITE,	ACTION_SEND_DATA,					COUNT_ACK | COUNT_BUSY },
+	[STATUS_INDEX(ADDRESS_WRITE_NACK_STATUS)]		= { RECEIVED_NACK,			CLASS_ADDRESS_WRITE,	ACTION_ADDRESS_NACKED,				COUNT_NACK | COUNT_BUSY },
+	[STATUS_INDEX(SENT_DATA_ACK_STATUS)]			= { RECEIVED_ACK,			CLASS_DATA_WRITE,		ACTION_DATA_ACKED,					COUNT_WRITTEN | COUNT_ACK | COUNT_BUSY },
+	[STATUS_INDEX(SENT_DATA_NACK_STATUS)]			= { RECEIVED_NACK,			CLASS_DATA_WRITE,		ACTION_DATA_NACKED,					COUNT_WRITTEN | COUNT_NACK | COUNT_BUSY },
+	[STATUS_INDEX(ARBITRATION_LOST_STATUS)]			= { ARBITRATION_LOST,		CLASS_ARBITRATION,		ACTION_ARBITRATION_LOST,			COUNT_LOST | COUNT_BUSY },
+	[STATUS_INDEX(ADDRESS_READ_ACK_STATUS)]			= { RECEIVED_ACK,			CLASS_ADDRESS_READ,		ACTION_START_READ,					COUNT_ACK | COUNT_BUSY },
+	[STATUS_INDEX(ADDRESS_READ_NACK_STATUS)]		= { RECEIVED_NACK,			CLASS_ADDRESS_READ,		ACTION_ADDRESS_NACKED,				COUNT_NACK | COUNT_BUSY },
+	[STATUS_INDEX(RECEIVED_DATA_ACK_STATUS)]		= { SENT_ACK,				CLASS_DATA_READ,		ACTION_READ_DATA,					COUNT_READ | COUNT_BUSY },
+	[STATUS_INDEX(RECEIVED_DATA_NACK_STATUS)]		= { SENT_NACK,				CLASS_DATA_READ,		ACTION_READ_LAST,					COUNT_READ | COUNT_BUSY },
+	[STATUS_INDEX(SLA_ADDRESSED_ACK_STATUS)]		= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_RECEIVE_START,			COUNT_NONE },
+	[STATUS_INDEX(LOST_SLA_ADDRESSED_STATUS)]		= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_RECEIVE_START_LOST,	COUNT_LOST | COUNT_BUSY },
+	[STATUS_INDEX(GC_ADDRESSED_ACK_STATUS)]			= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_RECEIVE_START,			COUNT_NONE },
+	[STATUS_INDEX(LOST_GC_ADDRESSED_STATUS)]		= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_RECEIVE_START_LOST,	COUNT_LOST | COUNT_BUSY },
+	[STATUS_INDEX(SLA_ADDRESSED_ACK_DATA_STATUS)]	= { SENT_ACK,				CLASS_SLAVE_RECEIVE,	ACTION_SLAVE_RECEIVE_DATA,			COUNT_READ },
+	[STATUS_INDEX(SLA_ADDRESSED_NACK_DATA_STATUS)]	= { SENT_NACK,				CLASS_SLAVE_RECEIVE,	ACTION_SLAVE_RECEIVE_LAST,			COUNT_READ },
+	[STATUS_INDEX(GC_ADDRESSED_ACK_DATA_STATUS)]	= { SENT_ACK,				CLASS_SLAVE_RECEIVE,	ACTION_SLAVE_RECEIVE_DATA,			COUNT_READ },
+	[STATUS_INDEX(GC_ADDRESSED_NACK_DATA_STATUS)]	= { SENT_NACK,				CLASS_SLAVE_RECEIVE,	ACTION_SLAVE_RECEIVE_LAST,			COUNT_READ },
+	[STATUS_INDEX(SLAVE_STOP_STATUS)]				= { DATA_ERROR,				CLASS_SLAVE_STOP,		ACTION_SLAVE_STOP,					COUNT_NONE },
+	[STATUS_INDEX(SLA_ADDRESSED_READ_ACK_STATUS)]	= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_TRANSMIT_START,		COUNT_NONE },
+	[STATUS_INDEX(LOST_SLA_ADDRESSED_READ_STATUS)]	= { SENT_ACK,				CLASS_SLAVE_ADDRESS,	ACTION_SLAVE_TRANSMIT_START_LOST,	COUNT_LOST | COUNT_BUSY },
+	[STATUS_INDEX(SLAVE_SENT_ACK_STATUS)]			= { RECEIVED_ACK,			CLASS_SLAVE_TRANSMIT,	ACTION_SLAVE_TRANSMIT_DATA,			COUNT_WRITTEN | COUNT_ACK },
+	[STATUS_INDEX(SLAVE_SENT_NACK_STATUS)]			= { RECEIVED_NACK,			CLASS_SLAVE_TRANSMIT,	ACTION_SLAVE_TRANSMIT_END,			COUNT_WRITTEN | COUNT_NACK },
+	[STATUS_INDEX(SLAVE_LAST_DATA_ACK_STATUS)]		= { RECEIVED_ACK,			CLASS_SLAVE_TRANSMIT,	ACTION_SLAVE_TRANSMIT_END,			COUNT_WRITTEN | COUNT_ACK },
+	[STATUS_INDEX(NO_INFO_STATUS)]					= { TIMEOUT,				CLASS_TIMEOUT,			ACTION_UNEXPECTED,					COUNT_NONE },
+};
+
+/* Transaction currently executed by the interrupt routine (NULL when idle) */
+static I2C_Transaction* volatile GLOB_PtrTransaction = NULL;
+/* Single-producer/single-consumer ring of transactions waiting for the bus:
+ * the head is only written by the submitter, the tail is advanced by the interrupt routine
+ * (or by the submitter while the bus is idle and the interrupt routine has nothing to do)
+ */
+static I2C_Transaction* GLOB_APtrQueue[QUEUE_SIZE];
+static volatile u8 GLOB_U8QueueHead = 0;
+static volatile u8 GLOB_U8QueueTail = 0;
+/* Index of the next byte in the buffer of the current phase */
+static u16 GLOB_U16Index = 0;
+/* Step of the transaction the interrupt routine is waiting for */
+static u8 GLOB_U8Phase = PHASE_START;
+/* Remaining calls to I2C_U8MasterTick before the running transaction times out */
+static volatile u16 GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+/* Set by I2C_U8MasterTick when the running transaction timed out, served from the main context */
+static volatile u8 GLOB_U8TimeoutPending = 0;
+/* Remaining calls to I2C_U8MasterTick before a transaction that lost arbitration is replayed */
+static volatile u8 GLOB_U8BackoffTicks = 0;
+/* State of the generator of random backoff waits */
+static u16 GLOB_U16Random = RANDOM_SEED;
+/* Number of times the interrupt flag is polled before a blocking operation gives up */
+static u32 GLOB_U32TimeoutBudget = TIMEOUT_BUDGET;
+/* Number of polls covering TIMEOUT_BYTE_TIMES bytes at the current SCL speed (the budget never goes below it) */
+static u32 GLOB_U32TimeoutFloor = 0;
+/* SCL speed profile currently written in the bit rate and prescaler registers */
+static I2C_SpeedProfile GLOB_StrSpeed;
+/* Prescaler values indexed by the TWPS1:TWPS0 bits */
+static const u8 GLOB_AU8Prescalers[PRESCALER_OPTIONS] = { PRESCALER_1, PRESCALER_4, PRESCALER_16, PRESCALER_64 };
+/* TWCR bits that keep the slave listening (0 while the slave mode is off) */
+static volatile u8 GLOB_U8SlaveControl = 0;
+/* Register map exposed by the slave mode and its register pointer */
+static u8* GLOB_U8SlaveRegisters = NULL;
+static u16 GLOB_U16SlaveSize = 0;
+static u16 GLOB_U16SlavePointer = 0;
+/* Set once the first byte of a write has loaded the register pointer */
+static u8 GLOB_U8SlavePointerSet = 0;
+/* First register and number of bytes stored by the current write */
+static u16 GLOB_U16SlaveWriteStart = 0;
+static u16 GLOB_U16SlaveWritten = 0;
+/* Write notification of the slave mode */
+static void (*GLOB_VidSlavePtrCallBack)(u16 LOC_U16Register, u16 LOC_U16Length) = NULL;
+/* Ring receiving the data written to the slave (NULL to store it in the register map):
+ * the head is only written by the interrupt routine, the tail by the consumer
+ */
+static u8* GLOB_U8SlaveRing = NULL;
+static u8 GLOB_U8RingMask = 0;
+static volatile u8 GLOB_U8RingHead = 0;
+static volatile u8 GLOB_U8RingTail = 0;
+/* Ring position at the end of every received frame that is not consumed yet */
+static volatile u8 GLOB_AU8FrameEnds[FRAME_QUEUE_SIZE];
+static volatile u8 GLOB_U8FrameHead = 0;
+static volatile u8 GLOB_U8FrameTail = 0;
+/* Set once a byte of the current frame is stored in the ring */
+static u8 GLOB_U8FrameOpen = 0;
+/* Set while the slave holds SCL low waiting for room in the ring */
+static volatile u8 GLOB_U8SlaveStalled = 0;
+/* Source of the data read from the slave when it is not the register map */
+static const u8* GLOB_U8SlaveTxBuffer = NULL;
+static u16 GLOB_U16SlaveTxLength = 0;
+static u16 GLOB_U16SlaveTxIndex = 0;
+static u8 (*GLOB_U8SlavePtrProducer)(u8* const LOC_U8Data) = NULL;
+#if ENABLE_STATISTICS == STATISTICS
+/* Bus statistics: the version changes with every update (main context updates run with interrupts disabled) */
+static I2C_BusStats GLOB_StrBusStats;
+static volatile u8 GLOB_U8StatsVersion = 0;
+/* TCNT1 at the previous bus event of the running master transaction */
+static u16 GLOB_U16BusyMark = 0;
+/* Statistics of the device whose blocking transfer is running (NULL otherwise) */
+static I2C_DeviceStats* GLOB_PtrDeviceStats = NULL;
+#endif
+#if ENABLE_TRACE == TRACE
+/* Bus event trace: the head runs freely, the count stops at the trace size */
+static I2C_TraceEntry GLOB_AStrTrace[TRACE_SIZE];
+static volatile u8 GLOB_U8TraceHead = 0;
+static volatile u8 GLOB_U8TraceCount = 0;
+#endif
+
 /************************************************************************************/
 /* 						  PUBLIC FUNCTIONS IMPLEMENTATION	  						*/
 /************************************************************************************/
@@ -41,6 +159,28 @@ u8 I2C_U8Init(void)
 	SET_BIT(TWSR_REGISTER, TWPS0);
 #else
 #error "Invalid I2C prescaler configuration"
+#endif
+#if TIMEOUT_BYTE_TIMES < 1 || TIMEOUT_BYTE_TIMES > 255
+#error "Invalid I2C timeout floor configuration. It should be from 1 to 255 byte times."
+#endif
+#if QUEUE_SIZE < 2 || QUEUE_SIZE > 128 || ( QUEUE_SIZE & QUEUE_MASK ) != 0
+#error "Invalid I2C queue size configuration. It should be a power of two from 2 to 128."
+#endif
+#if FRAME_QUEUE_SIZE < 2 || FRAME_QUEUE_SIZE > 128 || ( FRAME_QUEUE_SIZE & FRAME_QUEUE_MASK ) != 0
+#error "Invalid I2C frame queue size configuration. It should be a power of two from 2 to 128."
+#endif
+#if ENABLE_STATISTICS == STATISTICS
+#elif DISABLE_STATISTICS == STATISTICS
+#else
+#error "Invalid I2C statistics configuration"
+#endif
+#if ENABLE_TRACE == TRACE
+#if TRACE_SIZE < 2 || TRACE_SIZE > 128 || ( TRACE_SIZE & TRACE_MASK ) != 0
+#error "Invalid I2C trace size configuration. It should be a power of two from 2 to 128."
+#endif
+#elif DISABLE_TRACE == TRACE
+#else
+#error "Invalid I2C trace configuration"
 #endif
 	/* Slave Address Configuration */
 #if SLAVE_ADDRESS >= MINIMUM_ADDRESS && SLAVE_ADDRESS <= MAXIMUM_ADDRESS
@@ -56,28 +196,95 @@ u8 I2C_U8Init(void)
 #else
 #error "Invalid general call configuration"
 #endif
+	/* Masters with different own addresses draw different backoff waits */
+	GLOB_U16Random = RANDOM_SEED ^ SLAVE_ADDRESS;
+	/* Remember the configured speed to skip redundant switches later */
+	GLOB_StrSpeed.BitRate = TWBR_REGISTER;
+	GLOB_StrSpeed.Prescaler = TWSR_REGISTER & MASK_PRESCALER_SELECT_BITS;
+	I2C_VidUpdateTimeoutFloor();
 	/* Enable I2C Peripheral */
 	SET_BIT(TWCR_REGISTER, TWEN);
 	return NO_ERROR;
 }
 
-u8 I2C_U8MasterStart(u8* const LOC_U8Status)
+u8 I2C_U8ComputeSpeed(const u32 LOC_U32Frequency, I2C_SpeedProfile* const LOC_PtrProfile, u32* const LOC_U32Achieved)
 {
-	if (LOC_U8Status != NULL)
+	if ( LOC_PtrProfile != NULL && LOC_U32Achieved != NULL && LOC_U32Frequency != 0 && \
+			(u32)F_CPU > (u32)SCL_FIXED_CYCLES * LOC_U32Frequency )
 	{
-		I2C_U8StartConditionSequence();
-		/* If START condition was transmitted successfully */
-		if ( START_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = SENT_START;
-		}
-		/* If the start byte was not transmitted successfully */
-		else
+		/* Cycles that the bit rate and prescaler have to add to the fixed ones */
+		const u32 LOC_U32Cycles = (u32)F_CPU - (u32)SCL_FIXED_CYCLES * LOC_U32Frequency;
+		for (u8 LOC_U8Select = 0; LOC_U8Select < PRESCALER_OPTIONS; LOC_U8Select++)
 		{
-			/* Update Status */
-			*LOC_U8Status = START_ERROR;
+			const u32 LOC_U32Step = (u32)SCL_BIT_RATE_FACTOR * GLOB_AU8Prescalers[LOC_U8Select] * LOC_U32Frequency;
+			/* Round up so that the achieved frequency never exceeds the requested one */
+			u32 LOC_U32BitRate = (LOC_U32Cycles + LOC_U32Step - 1) / LOC_U32Step;
+			if (LOC_U32BitRate <= MAXIMUM_BIT_RATE)
+			{
+				if (LOC_U32BitRate < MINIMUM_BIT_RATE)
+				{
+					LOC_U32BitRate = MINIMUM_BIT_RATE;
+				}
+				LOC_PtrProfile->BitRate = LOC_U32BitRate;
+				LOC_PtrProfile->Prescaler = LOC_U8Select;
+				*LOC_U32Achieved = (u32)F_CPU / ( SCL_FIXED_CYCLES + (u32)SCL_BIT_RATE_FACTOR * LOC_U32BitRate * GLOB_AU8Prescalers[LOC_U8Select] );
+				return NO_ERROR;
+			}
 		}
+		/* Requested frequency is too low even with the largest prescaler */
+		return ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SetSpeed(const I2C_SpeedProfile* const LOC_PtrProfile)
+{
+	/* The speed of a submitted transaction is switched by the interrupt routine */
+	if (GLOB_PtrTransaction == NULL)
+	{
+		return I2C_U8WriteSpeed(LOC_PtrProfile);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8GetSpeed(I2C_SpeedProfile* const LOC_PtrProfile)
+{
+	if (LOC_PtrProfile != NULL)
+	{
+		*LOC_PtrProfile = GLOB_StrSpeed;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SetFrequency(const u32 LOC_U32Frequency, u32* const LOC_U32Achieved)
+{
+	I2C_SpeedProfile LOC_StrProfile;
+	if (I2C_U8ComputeSpeed(LOC_U32Frequency, &LOC_StrProfile, LOC_U32Achieved) == NO_ERROR)
+	{
+		return I2C_U8SetSpeed(&LOC_StrProfile);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8MasterStart(u8* const LOC_U8Status)
+{
+	if (LOC_U8Status != NULL)
+	{
+		/* SENT_START if START condition was transmitted successfully */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8StartConditionSequence(), CLASS_START, START_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -90,19 +297,8 @@ u8 I2C_U8MasterRepeatedStart(u8* const LOC_U8Status)
 {
 	if (LOC_U8Status != NULL)
 	{
-		I2C_U8StartConditionSequence();
-		/* If the REPEATED START condition was transmitted successfully */
-		if ( REPEATED_START_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = SENT_REPEATED_START;
-		}
-		/* If the REPEATED START condition was not transmitted successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = REPEATED_START_ERROR;
-		}
+		/* SENT_REPEATED_START if the REPEATED START condition was transmitted successfully */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8StartConditionSequence(), CLASS_REPEATED_START, REPEATED_START_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -118,32 +314,8 @@ u8 I2C_U8MasterSendAddressWrite(const u8 LOC_U8Address, u8* const LOC_U8Status)
 		/* Load Address */
 		TWDR_REGISTER = LOC_U8Address;
 		TWDR_REGISTER <<= SHIFT_BY_ONE;
-		/* Send Address+W Byte */
-		I2C_U8InfoSequence();
-		/* If address byte was transmitted successfully and ACK has been received */
-		if ( ADDRESS_WRITE_ACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_ACK;
-		}
-		/* If address byte was transmitted successfully and NACK has been received */
-		else if ( ADDRESS_WRITE_NACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_NACK;
-		}
-		/* If arbitration was lost */
-		else if ( ARBITRATION_LOST_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = ARBITRATION_LOST;
-		}
-		/* If the address byte was not transmitted successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = ADDRESS_ERROR;
-		}
+		/* Send Address+W Byte - RECEIVED_ACK, RECEIVED_NACK or ARBITRATION_LOST if the address byte was transmitted */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8InfoSequence(ROLE_MASTER), CLASS_ADDRESS_WRITE, ADDRESS_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -158,32 +330,8 @@ u8 I2C_U8MasterSendData (const u8 LOC_U8Data, u8* const LOC_U8Status)
 	{
 		/* Load Data */
 		TWDR_REGISTER = LOC_U8Data;
-		/* Send Data Byte */
-		I2C_U8InfoSequence();
-		/* If data byte was transmitted successfully and ACK has been received */
-		if ( SENT_DATA_ACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_ACK;
-		}
-		/* If data byte was transmitted successfully and NACK has been received */
-		else if ( SENT_DATA_NACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_NACK;
-		}
-		/* If arbitration was lost */
-		else if ( ARBITRATION_LOST_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = ARBITRATION_LOST;
-		}
-		/* If data byte was not transmitted successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = DATA_ERROR;
-		}
+		/* Send Data Byte - RECEIVED_ACK, RECEIVED_NACK or ARBITRATION_LOST if the data byte was transmitted */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8InfoSequence(ROLE_MASTER), CLASS_DATA_WRITE, DATA_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -201,32 +349,8 @@ u8 I2C_U8MasterSendAddressRead(const u8 LOC_U8Address, u8* const LOC_U8Status)
 		TWDR_REGISTER <<= SHIFT_BY_ONE;
 		/* Activate Read Operation */
 		SET_BIT(TWDR_REGISTER, TWD0);
-		/* Send Address+R Byte */
-		I2C_U8InfoSequence();
-		/* If address byte was transmitted successfully and ACK has been received */
-		if ( ADDRESS_READ_ACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_ACK;
-		}
-		/* If address byte was transmitted successfully and NACK has been received */
-		else if ( ADDRESS_READ_NACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_NACK;
-		}
-		/* If arbitration was lost */
-		else if ( ARBITRATION_LOST_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = ARBITRATION_LOST;
-		}
-		/* If the address byte was not transmitted successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = ADDRESS_ERROR;
-		}
+		/* Send Address+R Byte - RECEIVED_ACK, RECEIVED_NACK or ARBITRATION_LOST if the address byte was transmitted */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8InfoSequence(ROLE_MASTER), CLASS_ADDRESS_READ, ADDRESS_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -241,30 +365,152 @@ u8 I2C_U8MasterReceiveData (u8* const LOC_U8Data, const u8 LOC_U8Response, u8* c
 	{
 		/* Send ACK or NACK pulse according to the passed parameter */
 		WRITE_BIT(TWCR_REGISTER, TWEA, LOC_U8Response);
-		/* Receive Data */
-		I2C_U8InfoSequence();
-		/* If data byte was received successfully and ACK has been sent */
-		if ( RECEIVED_DATA_ACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) )
+		/* Receive Data - SENT_ACK or SENT_NACK if the data byte was received successfully */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8InfoSequence(ROLE_MASTER), CLASS_DATA_READ, DATA_ERROR);
+		if (SENT_ACK == *LOC_U8Status || SENT_NACK == *LOC_U8Status)
 		{
-			/* Update Status */
-			*LOC_U8Status = SENT_ACK;
 			/* Store received data */
 			*LOC_U8Data = TWDR_REGISTER;
 		}
-		/* If data byte was received successfully and NACK has been sent */
-		else if ( RECEIVED_DATA_NACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) )
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8MasterWriteBuffer(const u8* const LOC_U8Data, const u16 LOC_U16Length, u16* const LOC_U16Count, u8* const LOC_U8Status)
+{
+	if (LOC_U8Data != NULL && LOC_U16Count != NULL && LOC_U8Status != NULL)
+	{
+		/* The control value is written whole: keep the interrupt and acknowledge bits as they are */
+		const u8 LOC_U8Keep = TWCR_REGISTER & TWCR_KEEP_MASK;
+		u16 LOC_U16Index = 0;
+		u8 LOC_U8Result = RECEIVED_ACK;
+		/* Send data bytes as long as the slave acknowledges them - RECEIVED_ACK, RECEIVED_NACK,
+		 * ARBITRATION_LOST, TIMEOUT or DATA_ERROR for every byte
+		 */
+		while (LOC_U16Index < LOC_U16Length && RECEIVED_ACK == LOC_U8Result)
+		{
+			/* Load Data */
+			TWDR_REGISTER = LOC_U8Data[LOC_U16Index];
+			/* Send Data Byte */
+			LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER | LOC_U8Keep), CLASS_DATA_WRITE, DATA_ERROR);
+			if (RECEIVED_ACK == LOC_U8Result || RECEIVED_NACK == LOC_U8Result)
+			{
+				LOC_U16Index++;
+			}
+		}
+		*LOC_U16Count = LOC_U16Index;
+		*LOC_U8Status = LOC_U8Result;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8MasterReadBuffer(u8* const LOC_U8Data, const u16 LOC_U16Length, u16* const LOC_U16Count, u8* const LOC_U8Status)
+{
+	if (LOC_U8Data != NULL && LOC_U16Length != 0 && LOC_U16Count != NULL && LOC_U8Status != NULL)
+	{
+		/* The acknowledge bit answers the bytes: only the interrupt bit is kept during the transfer */
+		const u8 LOC_U8Keep = TWCR_REGISTER & TWCR_KEEP_MASK;
+		u16 LOC_U16Index = 0;
+		u8 LOC_U8Result = SENT_ACK;
+		/* Receive data bytes, answering all of them with ACK except the last one - SENT_ACK,
+		 * SENT_NACK, ARBITRATION_LOST, TIMEOUT or DATA_ERROR for every byte
+		 */
+		while (LOC_U16Index < LOC_U16Length && SENT_ACK == LOC_U8Result)
 		{
-			/* Update Status */
-			*LOC_U8Status = SENT_NACK;
-			/* Store received data */
-			*LOC_U8Data = TWDR_REGISTER;
+			LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence( ( (LOC_U16Index + 1 < LOC_U16Length) ? TWCR_TRANSFER_ACK : TWCR_TRANSFER ) | ( LOC_U8Keep & TWCR_KEEP_INTERRUPT ) ), \
+					CLASS_DATA_READ, DATA_ERROR);
+			if (SENT_ACK == LOC_U8Result || SENT_NACK == LOC_U8Result)
+			{
+				/* Store received data */
+				LOC_U8Data[LOC_U16Index++] = TWDR_REGISTER;
+			}
+		}
+		/* Put the acknowledge bit back (TWINT is written as 0, so the flag is left set) */
+		TWCR_REGISTER = TWCR_ENABLED | LOC_U8Keep;
+		*LOC_U16Count = LOC_U16Index;
+		*LOC_U8Status = LOC_U8Result;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8MasterWriteRead(const u8 LOC_U8Address, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status)
+{
+	if ( LOC_U8Status != NULL && LOC_U8Address >= MINIMUM_ADDRESS && LOC_U8Address <= MAXIMUM_ADDRESS && \
+			( LOC_U16TxLength == 0 || LOC_U8TxData != NULL ) && ( LOC_U16RxLength == 0 || LOC_U8RxData != NULL ) )
+	{
+		/* The interrupt and acknowledge bits are off during the transaction and put back with the STOP */
+		const u8 LOC_U8Keep = TWCR_REGISTER & TWCR_KEEP_MASK;
+		u16 LOC_U16Count;
+		u8 LOC_U8Result;
+
+		/* Send START condition - SENT_START, ARBITRATION_LOST, TIMEOUT or START_ERROR */
+		LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER_START), CLASS_START, START_ERROR);
+		if (SENT_START == LOC_U8Result)
+		{
+			LOC_U8Result = COMPLETED;
+		}
+		/* Write phase (also used alone when there is nothing to read) */
+		if (COMPLETED == LOC_U8Result && ( LOC_U16TxLength != 0 || LOC_U16RxLength == 0 ))
+		{
+			/* Send Address+W Byte - RECEIVED_ACK, RECEIVED_NACK, ARBITRATION_LOST, TIMEOUT or ADDRESS_ERROR */
+			TWDR_REGISTER = (LOC_U8Address << SHIFT_BY_ONE) | WRITE_OPERATION;
+			LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER), CLASS_ADDRESS_WRITE, ADDRESS_ERROR);
+			/* An empty write phase only addresses the slave (ACK polling) */
+			if (RECEIVED_ACK == LOC_U8Result && LOC_U16TxLength != 0)
+			{
+				I2C_U8MasterWriteBuffer(LOC_U8TxData, LOC_U16TxLength, &LOC_U16Count, &LOC_U8Result);
+			}
+			if (RECEIVED_ACK == LOC_U8Result)
+			{
+				LOC_U8Result = COMPLETED;
+			}
+			/* Turn the bus around for the read phase */
+			if (COMPLETED == LOC_U8Result && LOC_U16RxLength != 0)
+			{
+				LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER_START), CLASS_REPEATED_START, REPEATED_START_ERROR);
+				if (SENT_REPEATED_START == LOC_U8Result)
+				{
+					LOC_U8Result = COMPLETED;
+				}
+			}
+		}
+		/* Read phase */
+		if (COMPLETED == LOC_U8Result && LOC_U16RxLength != 0)
+		{
+			/* Send Address+R Byte - RECEIVED_ACK, RECEIVED_NACK, ARBITRATION_LOST, TIMEOUT or ADDRESS_ERROR */
+			TWDR_REGISTER = (LOC_U8Address << SHIFT_BY_ONE) | READ_OPERATION;
+			LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER), CLASS_ADDRESS_READ, ADDRESS_ERROR);
+			if (RECEIVED_ACK == LOC_U8Result)
+			{
+				I2C_U8MasterReadBuffer(LOC_U8RxData, LOC_U16RxLength, &LOC_U16Count, &LOC_U8Result);
+				if (SENT_NACK == LOC_U8Result)
+				{
+					LOC_U8Result = COMPLETED;
+				}
+			}
+		}
+		/* Send STOP condition unless the bus was lost to another master */
+		if (ARBITRATION_LOST == LOC_U8Result)
+		{
+			TWCR_REGISTER = TWCR_TRANSFER | LOC_U8Keep;
 		}
-		/* If data byte was not received successfully */
 		else
 		{
-			/* Update Status */
-			*LOC_U8Status = DATA_ERROR;
+			TWCR_REGISTER = TWCR_STOP | LOC_U8Keep;
 		}
+		*LOC_U8Status = LOC_U8Result;
 		return NO_ERROR;
 	}
 	else
@@ -284,6 +530,86 @@ u8 I2C_U8MasterStop(void)
 	return NO_ERROR;
 }
 
+u8 I2C_U8MasterScan(u8* const LOC_U8Presence, const u8* const LOC_U8Select, u8* const LOC_U8Changed, const u32 LOC_U32Frequency, u8* const LOC_U8Status)
+{
+	I2C_SpeedProfile LOC_StrProfile;
+	u32 LOC_U32Achieved;
+	if ( LOC_U8Presence != NULL && LOC_U8Status != NULL && GLOB_PtrTransaction == NULL && \
+			( LOC_U32Frequency == 0 || NO_ERROR == I2C_U8ComputeSpeed(LOC_U32Frequency, &LOC_StrProfile, &LOC_U32Achieved) ) )
+	{
+		const I2C_SpeedProfile LOC_StrSaved = GLOB_StrSpeed;
+		/* The interrupt and acknowledge bits are off during the scan and put back with the STOP */
+		const u8 LOC_U8Keep = TWCR_REGISTER & TWCR_KEEP_MASK;
+		u8 LOC_U8Result = COMPLETED;
+		u8 LOC_U8Started = 0;
+		u8 LOC_U8Address;
+
+		if (LOC_U32Frequency != 0)
+		{
+			I2C_U8SetSpeed(&LOC_StrProfile);
+		}
+		if (LOC_U8Changed != NULL)
+		{
+			for (u8 LOC_U8Byte = 0; LOC_U8Byte < I2C_PRESENCE_MAP_SIZE; LOC_U8Byte++)
+			{
+				LOC_U8Changed[LOC_U8Byte] = 0;
+			}
+		}
+
+		for (LOC_U8Address = MINIMUM_ADDRESS; LOC_U8Address <= MAXIMUM_ADDRESS && COMPLETED == LOC_U8Result; LOC_U8Address++)
+		{
+			const u8 LOC_U8Byte = LOC_U8Address >> PRESENCE_BYTE_SHIFT;
+			const u8 LOC_U8Bit = 1 << ( LOC_U8Address & PRESENCE_BIT_MASK );
+			if ( LOC_U8Select == NULL || ( LOC_U8Select[LOC_U8Byte] & LOC_U8Bit ) )
+			{
+				/* START for the first address, REPEATED START for the next ones */
+				const u8 LOC_U8Class = LOC_U8Started ? CLASS_REPEATED_START : CLASS_START;
+				LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER_START), LOC_U8Class, START_ERROR);
+				LOC_U8Started = 1;
+				if (SENT_START == LOC_U8Result || SENT_REPEATED_START == LOC_U8Result)
+				{
+					/* Send Address+W Byte - RECEIVED_ACK, RECEIVED_NACK, ARBITRATION_LOST, TIMEOUT or ADDRESS_ERROR */
+					TWDR_REGISTER = (LOC_U8Address << SHIFT_BY_ONE) | WRITE_OPERATION;
+					LOC_U8Result = I2C_U8DecodeStatus(I2C_U8TransferSequence(TWCR_TRANSFER), CLASS_ADDRESS_WRITE, ADDRESS_ERROR);
+					if (RECEIVED_ACK == LOC_U8Result || RECEIVED_NACK == LOC_U8Result)
+					{
+						const u8 LOC_U8Present = ( RECEIVED_ACK == LOC_U8Result ) ? LOC_U8Bit : 0;
+						if ( ( LOC_U8Presence[LOC_U8Byte] ^ LOC_U8Present ) & LOC_U8Bit )
+						{
+							LOC_U8Presence[LOC_U8Byte] ^= LOC_U8Bit;
+							if (LOC_U8Changed != NULL)
+							{
+								LOC_U8Changed[LOC_U8Byte] |= LOC_U8Bit;
+							}
+						}
+						LOC_U8Result = COMPLETED;
+					}
+				}
+			}
+		}
+
+		/* Send STOP condition unless the bus was lost to another master */
+		if (ARBITRATION_LOST == LOC_U8Result)
+		{
+			TWCR_REGISTER = TWCR_TRANSFER | LOC_U8Keep;
+		}
+		else if (LOC_U8Started)
+		{
+			TWCR_REGISTER = TWCR_STOP | LOC_U8Keep;
+		}
+		if (LOC_U32Frequency != 0)
+		{
+			I2C_U8SetSpeed(&LOC_StrSaved);
+		}
+		*LOC_U8Status = LOC_U8Result;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
 
 
 
@@ -298,24 +624,8 @@ u8 I2C_U8SlaveWaitForAddress(u8* const LOC_U8Status)
 		/* Enable Acknowledge Bit */
 		SET_BIT(TWCR_REGISTER, TWEA);
 
-		/* Wait until addressed */
-		while ( !GET_BIT(TWCR_REGISTER, TWINT) );
-
-		/* If slave was addressed successfully */
-		if ( SLA_ADDRESSED_ACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) || \
-				GC_ADDRESSED_ACK_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) || \
-				LOST_SLA_ADDRESSED_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) || \
-				LOST_GC_ADDRESSED_STATUS == (TWSR_REGISTER & MASK_PRESCALER_BITS) )
-		{
-			/* Update Status */
-			*LOC_U8Status = SENT_ACK;
-		}
-		/* If slave was not addressed successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = ADDRESS_ERROR;
-		}
+		/* Wait until addressed - SENT_ACK if slave was addressed successfully (for a write or a read operation) */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8WaitSequence(ROLE_SLAVE), CLASS_SLAVE_ADDRESS, ADDRESS_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -333,33 +643,13 @@ u8 I2C_U8SlaveReceiveData(u8* const LOC_U8Data, const u8 LOC_U8Response, u8* con
 		/* Clear Flag */
 		SET_BIT(TWCR_REGISTER, TWINT);
 
-		/* Wait until data is received */
-		while ( !GET_BIT(TWCR_REGISTER, TWINT) );
-
-		/* If data was received successfully and ACK was returned */
-		if ( SLA_ADDRESSED_ACK_DATA_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS )  || \
-				GC_ADDRESSED_ACK_DATA_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = SENT_ACK;
-			/* Get Received Data */
-			*LOC_U8Data = TWDR_REGISTER;
-		}
-		/* If data was received successfully and NACK was returned */
-		else if ( SLA_ADDRESSED_NACK_DATA_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS )  || \
-				GC_ADDRESSED_NACK_DATA_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
+		/* Wait until data is received - SENT_ACK or SENT_NACK if data was received successfully */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8WaitSequence(ROLE_SLAVE), CLASS_SLAVE_RECEIVE, DATA_ERROR);
+		if (SENT_ACK == *LOC_U8Status || SENT_NACK == *LOC_U8Status)
 		{
-			/* Update Status */
-			*LOC_U8Status = SENT_NACK;
 			/* Get Received Data */
 			*LOC_U8Data = TWDR_REGISTER;
 		}
-		/* If data was not received successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = DATA_ERROR;
-		}
 		return NO_ERROR;
 	}
 	else
@@ -374,27 +664,8 @@ u8 I2C_U8SlaveSendData (const u8 LOC_U8Data, u8* const LOC_U8Status)
 	{
 		/* Load Data */
 		TWDR_REGISTER = LOC_U8Data;
-		/* Send Data Byte */
-		I2C_U8InfoSequence();
-		/* If data byte was transmitted successfully and ACK has been received */
-		if ( SLAVE_SENT_ACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) || \
-				SLAVE_LAST_DATA_ACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_ACK;
-		}
-		/* If data byte was transmitted successfully and NACK has been received */
-		else if ( SLAVE_SENT_NACK_STATUS == ( TWSR_REGISTER & MASK_PRESCALER_BITS ) )
-		{
-			/* Update Status */
-			*LOC_U8Status = RECEIVED_NACK;
-		}
-		/* If data byte was not transmitted successfully */
-		else
-		{
-			/* Update Status */
-			*LOC_U8Status = DATA_ERROR;
-		}
+		/* Send Data Byte - RECEIVED_ACK or RECEIVED_NACK if the data byte was transmitted successfully */
+		*LOC_U8Status = I2C_U8DecodeStatus(I2C_U8InfoSequence(ROLE_SLAVE), CLASS_SLAVE_TRANSMIT, DATA_ERROR);
 		return NO_ERROR;
 	}
 	else
@@ -433,47 +704,1181 @@ u8 I2C_U8SetCallBack( void (*ptrToFun) (void) )
 		return ERROR;
 	}
 }
-/************************************************************************************/
 
+u8 I2C_U8SetTimeout(const u32 LOC_U32Budget)
+{
+	if (LOC_U32Budget != 0)
+	{
+		GLOB_U32TimeoutBudget = LOC_U32Budget;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
 
-/************************************************************************************/
-/* 						  PRIVATE FUNCTIONS IMPLEMENTATION  						*/
-/************************************************************************************/
-void __vector_19(void)
+u8 I2C_U8BusRecovery(void)
 {
-	if (GLOB_VidI2CPtrCallBack != NULL)
+	u8 LOC_U8Sda = DIO_PIN_LOW;
+	/* Disable the I2C peripheral to take SCL and SDA over as DIO pins */
+	TWCR_REGISTER = TWCR_DISABLED;
+	/* Pins are driven low as outputs and released (pulled up) as inputs */
+	DIO_U8SetPinValue(SCL_PORT, SCL_PIN, DIO_PIN_LOW);
+	DIO_U8SetPinValue(SDA_PORT, SDA_PIN, DIO_PIN_LOW);
+	DIO_U8SetPinDirection(SDA_PORT, SDA_PIN, DIO_PIN_INPUT);
+	DIO_U8SetPinDirection(SCL_PORT, SCL_PIN, DIO_PIN_INPUT);
+	_delay_us(RECOVERY_HALF_PERIOD_US);
+	DIO_U8GetPinValue(SDA_PORT, SDA_PIN, &LOC_U8Sda);
+	/* Clock SCL until the slave finishes its byte and releases SDA */
+	for (u8 LOC_U8Pulse = 0; LOC_U8Pulse < RECOVERY_CLOCK_PULSES && DIO_PIN_LOW == LOC_U8Sda; LOC_U8Pulse++)
 	{
-		(*GLOB_VidI2CPtrCallBack)();
+		DIO_U8SetPinDirection(SCL_PORT, SCL_PIN, DIO_PIN_OUTPUT);
+		_delay_us(RECOVERY_HALF_PERIOD_US);
+		DIO_U8SetPinDirection(SCL_PORT, SCL_PIN, DIO_PIN_INPUT);
+		_delay_us(RECOVERY_HALF_PERIOD_US);
+		DIO_U8GetPinValue(SDA_PORT, SDA_PIN, &LOC_U8Sda);
+	}
+	/* Generate a STOP condition: SDA rises while SCL is high */
+	DIO_U8SetPinDirection(SCL_PORT, SCL_PIN, DIO_PIN_OUTPUT);
+	DIO_U8SetPinDirection(SDA_PORT, SDA_PIN, DIO_PIN_OUTPUT);
+	_delay_us(RECOVERY_HALF_PERIOD_US);
+	DIO_U8SetPinDirection(SCL_PORT, SCL_PIN, DIO_PIN_INPUT);
+	_delay_us(RECOVERY_HALF_PERIOD_US);
+	DIO_U8SetPinDirection(SDA_PORT, SDA_PIN, DIO_PIN_INPUT);
+	_delay_us(RECOVERY_HALF_PERIOD_US);
+	DIO_U8GetPinValue(SDA_PORT, SDA_PIN, &LOC_U8Sda);
+	/* Give the pins back to the I2C peripheral, listening again if the slave mode is on */
+	TWCR_REGISTER = TWCR_ENABLED | GLOB_U8SlaveControl;
+	if (DIO_PIN_HIGH == LOC_U8Sda)
+	{
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
 	}
 }
 
-static u8 I2C_U8StartConditionSequence(void)
+u8 I2C_U8MasterSubmit(I2C_Transaction* const LOC_PtrTransaction)
 {
-	/* Clear Stop Condition */
-	CLR_BIT(TWCR_REGISTER, TWSTO);
-	/* Set Start Condition */
-	SET_BIT(TWCR_REGISTER, TWSTA);
-	/* Clear Flag - Start Operation */
-	SET_BIT(TWCR_REGISTER, TWINT);
+	const u8 LOC_U8Head = GLOB_U8QueueHead;
+	if ( LOC_PtrTransaction != NULL && (u8)(LOC_U8Head - GLOB_U8QueueTail) < QUEUE_SIZE && \
+			LOC_PtrTransaction->Address >= MINIMUM_ADDRESS && LOC_PtrTransaction->Address <= MAXIMUM_ADDRESS && \
+			( LOC_PtrTransaction->TxLength == 0 || LOC_PtrTransaction->TxBuffer != NULL ) && \
+			( LOC_PtrTransaction->RxLength == 0 || LOC_PtrTransaction->RxBuffer != NULL ) )
+	{
+		const u8 LOC_U8Sreg = SREG_REGISTER;
+		LOC_PtrTransaction->Status = BUSY;
+		/* The interrupt routine must not finish or chain a transaction in the middle of the hand-over */
+		CLR_BIT(SREG_REGISTER, SREG_I);
+		/* Fill the slot before publishing it to the interrupt routine */
+		GLOB_APtrQueue[LOC_U8Head & QUEUE_MASK] = LOC_PtrTransaction;
+		GLOB_U8QueueHead = LOC_U8Head + 1;
+		/* If the bus is idle, nothing will chain the transaction: start it here */
+		if (GLOB_PtrTransaction == NULL)
+		{
+			I2C_VidPrepareTransaction(GLOB_APtrQueue[GLOB_U8QueueTail & QUEUE_MASK]);
+			GLOB_U8QueueTail++;
+			/* Request the START condition, the rest is done by the interrupt routine
+			 * (a stalled slave sends it itself once the consumer lets it go on)
+			 */
+			if (!GLOB_U8SlaveStalled)
+			{
+				TWCR_REGISTER = TWCR_REQUEST_START | GLOB_U8SlaveControl;
+			}
+		}
+		SREG_REGISTER = LOC_U8Sreg;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
 
-	/* Wait until START condition has been transmitted */
-	while ( !GET_BIT(TWCR_REGISTER, TWINT) );
+u8 I2C_U8MasterWriteReadAsync(I2C_Transaction* const LOC_PtrTransaction, const u8 LOC_U8Address, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength)
+{
+	if (LOC_PtrTransaction != NULL)
+	{
+		/* Fill the descriptor then let the interrupt routine run it */
+		LOC_PtrTransaction->Address = LOC_U8Address;
+		LOC_PtrTransaction->TxBuffer = LOC_U8TxData;
+		LOC_PtrTransaction->TxLength = LOC_U16TxLength;
+		LOC_PtrTransaction->RxBuffer = LOC_U8RxData;
+		LOC_PtrTransaction->RxLength = LOC_U16RxLength;
+		return I2C_U8MasterSubmit(LOC_PtrTransaction);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
 
+u8 I2C_U8MasterTick(void)
+{
+	/* A slave holding SCL low on purpose keeps the transaction waiting for the bus */
+	if (GLOB_PtrTransaction != NULL && !GLOB_U8SlaveStalled)
+	{
+		if (PHASE_BACKOFF == GLOB_U8Phase)
+		{
+			/* End of the random wait: contend for the bus again */
+			if (--GLOB_U8BackoffTicks == 0)
+			{
+				GLOB_U8Phase = PHASE_START;
+				GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+				/* TWINT is left alone so that a pending slave event is served first */
+				TWCR_REGISTER = TWCR_REQUEST_START | GLOB_U8SlaveControl;
+			}
+		}
+		else if (GLOB_U16EngineTicks != 0)
+		{
+			GLOB_U16EngineTicks--;
+		}
+		else
+		{
+			/* No bus event for too long: the bus recovery and the callbacks are left to the main context */
+			GLOB_U8TimeoutPending = 1;
+		}
+	}
 	return NO_ERROR;
 }
 
-static u8 I2C_U8InfoSequence(void)
+u8 I2C_U8MasterIsBusy(u8* const LOC_U8Busy)
 {
-	/* Clear Start Condition */
-	CLR_BIT(TWCR_REGISTER, TWSTA);
-	/* Clear Stop Condition */
-	CLR_BIT(TWCR_REGISTER, TWSTO);
-	/* Clear Flag - Start Operation */
-	SET_BIT(TWCR_REGISTER, TWINT);
+	if (LOC_U8Busy != NULL)
+	{
+		I2C_VidServiceTimeout();
+		*LOC_U8Busy = ( GLOB_PtrTransaction != NULL );
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
 
-	/* Wait until info byte has been transmitted or received */
-	while ( !GET_BIT(TWCR_REGISTER, TWINT) );
+u8 I2C_U8DeviceInit(I2C_Device* const LOC_PtrDevice, const u8 LOC_U8Address, const u32 LOC_U32Frequency, const u8 LOC_U8MaxRetries, const u32 LOC_U32Timeout)
+{
+	u32 LOC_U32Achieved;
+	if ( LOC_PtrDevice != NULL && LOC_U8Address >= MINIMUM_ADDRESS && LOC_U8Address <= MAXIMUM_ADDRESS && \
+			I2C_U8ComputeSpeed(LOC_U32Frequency, &LOC_PtrDevice->Speed, &LOC_U32Achieved) == NO_ERROR )
+	{
+		LOC_PtrDevice->Address = LOC_U8Address;
+		LOC_PtrDevice->MaxRetries = LOC_U8MaxRetries;
+		LOC_PtrDevice->Timeout = ( LOC_U32Timeout != 0 ) ? LOC_U32Timeout : TIMEOUT_BUDGET;
+		return I2C_U8DeviceResetStats(LOC_PtrDevice);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
 
+u8 I2C_U8DeviceWrite(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status)
+{
+	return I2C_U8DeviceTransfer(LOC_PtrDevice, LOC_U8Data, LOC_U16Length, NULL, 0, LOC_U8Status);
+}
+
+u8 I2C_U8DeviceRead(I2C_Device* const LOC_PtrDevice, u8* const LOC_U8Data, const u16 LOC_U16Length, u8* const LOC_U8Status)
+{
+	if (LOC_U16Length != 0)
+	{
+		return I2C_U8DeviceTransfer(LOC_PtrDevice, NULL, 0, LOC_U8Data, LOC_U16Length, LOC_U8Status);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8DeviceWriteRead(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status)
+{
+	return I2C_U8DeviceTransfer(LOC_PtrDevice, LOC_U8TxData, LOC_U16TxLength, LOC_U8RxData, LOC_U16RxLength, LOC_U8Status);
+}
+
+u8 I2C_U8DeviceResetStats(I2C_Device* const LOC_PtrDevice)
+{
+	if (LOC_PtrDevice != NULL)
+	{
+		LOC_PtrDevice->Stats = (I2C_DeviceStats){ 0 };
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8GetBusStats(I2C_BusStats* const LOC_PtrStats)
+{
+#if ENABLE_STATISTICS == STATISTICS
+	if (LOC_PtrStats != NULL)
+	{
+		u8 LOC_U8Version;
+		/* Copy again if the interrupt routine changed the statistics during the copy */
+		do
+		{
+			LOC_U8Version = GLOB_U8StatsVersion;
+			*LOC_PtrStats = GLOB_StrBusStats;
+		} while (LOC_U8Version != GLOB_U8StatsVersion);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+#else
+	(void)LOC_PtrStats;
+	return ERROR;
+#endif
+}
+
+u8 I2C_U8ResetBusStats(void)
+{
+#if ENABLE_STATISTICS == STATISTICS
+	const u8 LOC_U8Sreg = SREG_REGISTER;
+	/* The interrupt routine must not update a half cleared copy */
+	CLR_BIT(SREG_REGISTER, SREG_I);
+	GLOB_StrBusStats = (I2C_BusStats){ 0 };
+	GLOB_U8StatsVersion++;
+	SREG_REGISTER = LOC_U8Sreg;
 	return NO_ERROR;
+#else
+	return ERROR;
+#endif
+}
+
+u8 I2C_U8SlaveRegisterMap(u8* const LOC_U8Registers, const u16 LOC_U16Size, void (*ptrToFun) (u16 LOC_U16Register, u16 LOC_U16Length))
+{
+	if (LOC_U8Registers != NULL && LOC_U16Size != 0 && LOC_U16Size <= MAXIMUM_MAP_SIZE && GLOB_PtrTransaction == NULL)
+	{
+		GLOB_U8SlaveRegisters = LOC_U8Registers;
+		GLOB_U16SlaveSize = LOC_U16Size;
+		GLOB_U16SlavePointer = 0;
+		GLOB_U8SlavePointerSet = 0;
+		GLOB_U16SlaveWritten = 0;
+		GLOB_VidSlavePtrCallBack = ptrToFun;
+		I2C_VidSlaveListen();
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlaveReceiveRing(u8* const LOC_U8Buffer, const u16 LOC_U16Size)
+{
+	if ( LOC_U8Buffer != NULL && LOC_U16Size >= MINIMUM_RING_SIZE && LOC_U16Size <= MAXIMUM_RING_SIZE && \
+			( LOC_U16Size & (LOC_U16Size - 1) ) == 0 && GLOB_PtrTransaction == NULL )
+	{
+		GLOB_U8SlaveRing = LOC_U8Buffer;
+		GLOB_U8RingMask = LOC_U16Size - 1;
+		GLOB_U8RingHead = 0;
+		GLOB_U8RingTail = 0;
+		GLOB_U8FrameHead = 0;
+		GLOB_U8FrameTail = 0;
+		GLOB_U8FrameOpen = 0;
+		I2C_VidSlaveListen();
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlaveTransmitBuffer(const u8* const LOC_U8Data, const u16 LOC_U16Length)
+{
+	if (LOC_U8Data != NULL && LOC_U16Length != 0 && GLOB_PtrTransaction == NULL)
+	{
+		GLOB_U8SlavePtrProducer = NULL;
+		GLOB_U8SlaveTxBuffer = LOC_U8Data;
+		GLOB_U16SlaveTxLength = LOC_U16Length;
+		GLOB_U16SlaveTxIndex = 0;
+		I2C_VidSlaveListen();
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlaveTransmitProducer( u8 (*ptrToFun) (u8* const LOC_U8Data) )
+{
+	if (GLOB_PtrTransaction == NULL)
+	{
+		GLOB_U8SlaveTxBuffer = NULL;
+		GLOB_U8SlavePtrProducer = ptrToFun;
+		if (ptrToFun != NULL)
+		{
+			I2C_VidSlaveListen();
+		}
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlavePeek(const u8** const LOC_PtrData, u16* const LOC_U16Length, u8* const LOC_U8FrameEnd)
+{
+	if (LOC_PtrData != NULL && LOC_U16Length != NULL && LOC_U8FrameEnd != NULL && GLOB_U8SlaveRing != NULL)
+	{
+		const u8 LOC_U8Tail = GLOB_U8RingTail;
+		u8 LOC_U8Limit = GLOB_U8RingHead;
+		u16 LOC_U16Count, LOC_U16Contiguous;
+		*LOC_U8FrameEnd = 0;
+		/* Do not hand out the bytes of the next frame with the oldest one */
+		if (GLOB_U8FrameTail != GLOB_U8FrameHead)
+		{
+			LOC_U8Limit = GLOB_AU8FrameEnds[GLOB_U8FrameTail & FRAME_QUEUE_MASK];
+			*LOC_U8FrameEnd = 1;
+		}
+		LOC_U16Count = (u8)(LOC_U8Limit - LOC_U8Tail) & GLOB_U8RingMask;
+		/* The span cannot run past the end of the buffer */
+		LOC_U16Contiguous = (u16)GLOB_U8RingMask + 1 - LOC_U8Tail;
+		if (LOC_U16Count > LOC_U16Contiguous)
+		{
+			LOC_U16Count = LOC_U16Contiguous;
+			*LOC_U8FrameEnd = 0;
+		}
+		*LOC_PtrData = &GLOB_U8SlaveRing[LOC_U8Tail];
+		*LOC_U16Length = LOC_U16Count;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlaveCommit(const u16 LOC_U16Length)
+{
+	if (GLOB_U8SlaveRing != NULL)
+	{
+		const u8 LOC_U8Tail = GLOB_U8RingTail;
+		const u8 LOC_U8Framed = ( GLOB_U8FrameTail != GLOB_U8FrameHead );
+		const u8 LOC_U8Limit = LOC_U8Framed ? GLOB_AU8FrameEnds[GLOB_U8FrameTail & FRAME_QUEUE_MASK] : GLOB_U8RingHead;
+		if (LOC_U16Length <= ( (u8)(LOC_U8Limit - LOC_U8Tail) & GLOB_U8RingMask ))
+		{
+			const u8 LOC_U8NewTail = (u8)(LOC_U8Tail + LOC_U16Length) & GLOB_U8RingMask;
+			GLOB_U8RingTail = LOC_U8NewTail;
+			/* The whole frame is consumed: drop its boundary */
+			if (LOC_U8Framed && LOC_U8NewTail == LOC_U8Limit)
+			{
+				GLOB_U8FrameTail++;
+			}
+			/* There is room again: let the interrupt routine take the held byte */
+			if (GLOB_U8SlaveStalled)
+			{
+				GLOB_U8SlaveStalled = 0;
+				TWCR_REGISTER = TWCR_SLAVE_RESUME;
+			}
+			return NO_ERROR;
+		}
+		else
+		{
+			return ERROR;
+		}
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8SlaveDisable(void)
+{
+	if (GLOB_PtrTransaction == NULL)
+	{
+		GLOB_U8SlaveControl = 0;
+		/* Stop acknowledging own address */
+		CLR_BIT(TWCR_REGISTER, TWEA);
+		CLR_BIT(TWCR_REGISTER, TWIE);
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 I2C_U8TraceDump( void (*ptrToFun) (const I2C_TraceEntry* const LOC_PtrEntry) )
+{
+#if ENABLE_TRACE == TRACE
+	if (ptrToFun != NULL)
+	{
+		u8 LOC_U8Count = GLOB_U8TraceCount;
+		u8 LOC_U8Index = GLOB_U8TraceHead - LOC_U8Count;
+		/* From the oldest event to the newest one */
+		while (LOC_U8Count != 0)
+		{
+			ptrToFun(&GLOB_AStrTrace[LOC_U8Index & TRACE_MASK]);
+			LOC_U8Index++;
+			LOC_U8Count--;
+		}
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+#else
+	(void)ptrToFun;
+	return ERROR;
+#endif
+}
+
+u8 I2C_U8TraceClear(void)
+{
+#if ENABLE_TRACE == TRACE
+	GLOB_U8TraceCount = 0;
+	GLOB_U8TraceHead = 0;
+	return NO_ERROR;
+#else
+	return ERROR;
+#endif
+}
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  PRIVATE FUNCTIONS IMPLEMENTATION  						*/
+/************************************************************************************/
+void __vector_19(void)
+{
+	/* Read the status register once per event and look up what to do next */
+	const u8 LOC_U8Status = TWSR_REGISTER;
+	const I2C_StatusEntry* const LOC_PtrEntry = &GLOB_AStrStatusTable[ STATUS_INDEX(LOC_U8Status) ];
+#if ENABLE_STATISTICS == STATISTICS
+	I2C_U16Count(LOC_PtrEntry);
+	GLOB_U8StatsVersion++;
+#endif
+#if ENABLE_TRACE == TRACE
+	I2C_VidTrace(LOC_U8Status & MASK_PRESCALER_BITS);
+#endif
+
+	/* Slave events (and bus errors outside a transaction) go to the slave engine while it is on */
+	if ( GLOB_U8SlaveControl != 0 && \
+			( ( LOC_PtrEntry->Class >= CLASS_SLAVE_ADDRESS && LOC_PtrEntry->Class <= CLASS_SLAVE_TRANSMIT ) || \
+			( CLASS_BUS_ERROR == LOC_PtrEntry->Class && GLOB_PtrTransaction == NULL ) ) )
+	{
+		const u8 LOC_U8Control = I2C_U8SlaveEngine(LOC_PtrEntry);
+		/* Being addressed while sending an address byte ends the running transaction */
+		if ( GLOB_PtrTransaction != NULL && \
+				( ACTION_SLAVE_RECEIVE_START_LOST == LOC_PtrEntry->Action || ACTION_SLAVE_TRANSMIT_START_LOST == LOC_PtrEntry->Action ) )
+		{
+			I2C_VidArbitrationLost(LOC_U8Control);
+		}
+		else
+		{
+			TWCR_REGISTER = LOC_U8Control;
+		}
+	}
+	/* A submitted transaction owns the interrupt until it is finished */
+	else if (GLOB_PtrTransaction != NULL)
+	{
+		I2C_VidMasterEngine(LOC_PtrEntry);
+	}
+	else if (GLOB_VidI2CPtrCallBack != NULL)
+	{
+		(*GLOB_VidI2CPtrCallBack)();
+	}
+}
+
+static void I2C_VidMasterEngine(const I2C_StatusEntry* const LOC_PtrEntry)
+{
+	I2C_Transaction* const LOC_PtrTransaction = GLOB_PtrTransaction;
+
+	/* The bus is alive: restart the engine timeout */
+	GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+
+	switch (LOC_PtrEntry->Action)
+	{
+	/* START or REPEATED START was transmitted: send the address byte */
+	case ACTION_SEND_ADDRESS:
+		GLOB_U16Index = 0;
+		/* An empty transaction only addresses the slave for writing */
+		if ( CLASS_START == LOC_PtrEntry->Class && ( LOC_PtrTransaction->TxLength != 0 || LOC_PtrTransaction->RxLength == 0 ) )
+		{
+			TWDR_REGISTER = (LOC_PtrTransaction->Address << SHIFT_BY_ONE) | WRITE_OPERATION;
+		}
+		else
+		{
+			TWDR_REGISTER = (LOC_PtrTransaction->Address << SHIFT_BY_ONE) | READ_OPERATION;
+		}
+		GLOB_U8Phase = PHASE_ADDRESS;
+		/* Keep acknowledging own address in case arbitration is lost to a master addressing this node */
+		TWCR_REGISTER = TWCR_SEND | GLOB_U8SlaveControl;
+		break;
+
+	/* Data byte was acknowledged by the slave */
+	case ACTION_DATA_ACKED:
+		LOC_PtrTransaction->Transferred++;
+		/* fall through */
+	/* Slave acknowledged its address with a write operation */
+	case ACTION_SEND_DATA:
+		GLOB_U8Phase = PHASE_DATA;
+		if (GLOB_U16Index < LOC_PtrTransaction->TxLength)
+		{
+			/* Send the next data byte */
+			TWDR_REGISTER = LOC_PtrTransaction->TxBuffer[GLOB_U16Index++];
+			TWCR_REGISTER = TWCR_SEND;
+		}
+		else if (LOC_PtrTransaction->RxLength != 0)
+		{
+			/* Turn the bus around for the read phase */
+			GLOB_U8Phase = PHASE_REPEATED_START;
+			TWCR_REGISTER = TWCR_START;
+		}
+		else
+		{
+			I2C_VidFinishTransaction(COMPLETED, TWCR_STOP);
+		}
+		break;
+
+	/* Slave acknowledged its address with a read operation */
+	case ACTION_START_READ:
+		GLOB_U8Phase = PHASE_DATA;
+		/* Only the last byte is answered with NACK */
+		TWCR_REGISTER = ( LOC_PtrTransaction->RxLength > 1 ) ? TWCR_RECEIVE_ACK : TWCR_RECEIVE_NACK;
+		break;
+
+	/* Data byte was received and ACK has been sent */
+	case ACTION_READ_DATA:
+		LOC_PtrTransaction->RxBuffer[GLOB_U16Index++] = TWDR_REGISTER;
+		LOC_PtrTransaction->Transferred++;
+		TWCR_REGISTER = ( LOC_PtrTransaction->RxLength - GLOB_U16Index > 1 ) ? TWCR_RECEIVE_ACK : TWCR_RECEIVE_NACK;
+		break;
+
+	/* Last data byte was received and NACK has been sent */
+	case ACTION_READ_LAST:
+		LOC_PtrTransaction->RxBuffer[GLOB_U16Index++] = TWDR_REGISTER;
+		LOC_PtrTransaction->Transferred++;
+		I2C_VidFinishTransaction(COMPLETED, TWCR_STOP);
+		break;
+
+	/* Data byte was not acknowledged by the slave */
+	case ACTION_DATA_NACKED:
+		LOC_PtrTransaction->Transferred++;
+		I2C_VidFinishTransaction(RECEIVED_NACK, TWCR_STOP);
+		break;
+
+	/* Address byte was not acknowledged by the slave */
+	case ACTION_ADDRESS_NACKED:
+		I2C_VidFinishTransaction(RECEIVED_NACK, TWCR_STOP);
+		break;
+
+	/* Arbitration was lost (possibly while being addressed as a slave):
+	 * release the bus without a STOP condition
+	 */
+	case ACTION_ARBITRATION_LOST:
+	case ACTION_SLAVE_RECEIVE_START_LOST:
+	case ACTION_SLAVE_TRANSMIT_START_LOST:
+		I2C_VidArbitrationLost(TWCR_RELEASE);
+		break;
+
+	/* Unexpected status: report the step that failed */
+	default:
+		if (GLOB_U8Phase == PHASE_START)
+		{
+			I2C_VidFinishTransaction(START_ERROR, TWCR_STOP);
+		}
+		else if (GLOB_U8Phase == PHASE_REPEATED_START)
+		{
+			I2C_VidFinishTransaction(REPEATED_START_ERROR, TWCR_STOP);
+		}
+		else if (GLOB_U8Phase == PHASE_ADDRESS)
+		{
+			COUNT_EVENT(AddressErrors);
+			I2C_VidFinishTransaction(ADDRESS_ERROR, TWCR_STOP);
+		}
+		else
+		{
+			COUNT_EVENT(DataErrors);
+			I2C_VidFinishTransaction(DATA_ERROR, TWCR_STOP);
+		}
+		break;
+	}
+}
+
+static u8 I2C_U8SlaveEngine(const I2C_StatusEntry* const LOC_PtrEntry)
+{
+	u8 LOC_U8Control = TWCR_SLAVE_ACK;
+
+	/* The bus is alive: restart the timeout of a transaction waiting for it */
+	GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+
+	switch (LOC_PtrEntry->Action)
+	{
+	/* Addressed for a write operation: the first data byte is the register pointer */
+	case ACTION_SLAVE_RECEIVE_START:
+	case ACTION_SLAVE_RECEIVE_START_LOST:
+		GLOB_U8SlavePointerSet = 0;
+		GLOB_U16SlaveWritten = 0;
+		/* Transmit only slave (no ring and no register map): answer the first data byte with NACK */
+		if (GLOB_U8SlaveRing == NULL && ( GLOB_U8SlaveRegisters == NULL || GLOB_U16SlaveSize == 0 ))
+		{
+			LOC_U8Control = TWCR_SLAVE_LAST;
+		}
+		break;
+
+	/* Data byte was received and ACK has been sent */
+	case ACTION_SLAVE_RECEIVE_DATA:
+		if (GLOB_U8SlaveRing != NULL)
+		{
+			const u8 LOC_U8Next = (u8)(GLOB_U8RingHead + 1) & GLOB_U8RingMask;
+			if (LOC_U8Next != GLOB_U8RingTail)
+			{
+				GLOB_U8SlaveRing[GLOB_U8RingHead] = TWDR_REGISTER;
+				GLOB_U8RingHead = LOC_U8Next;
+				GLOB_U8FrameOpen = 1;
+			}
+			else
+			{
+				/* Ring full: keep the byte in TWDR and SCL low until the consumer commits */
+				GLOB_U8SlaveStalled = 1;
+				LOC_U8Control = TWCR_SLAVE_STALL;
+			}
+		}
+		else if (GLOB_U8SlaveRegisters == NULL || GLOB_U16SlaveSize == 0)
+		{
+			/* Nowhere to store the byte: drop it and answer the next one with NACK */
+			LOC_U8Control = TWCR_SLAVE_LAST;
+		}
+		else if (!GLOB_U8SlavePointerSet)
+		{
+			GLOB_U16SlavePointer = TWDR_REGISTER % GLOB_U16SlaveSize;
+			GLOB_U16SlaveWriteStart = GLOB_U16SlavePointer;
+			GLOB_U8SlavePointerSet = 1;
+		}
+		else
+		{
+			GLOB_U8SlaveRegisters[GLOB_U16SlavePointer] = TWDR_REGISTER;
+			GLOB_U16SlavePointer = ( GLOB_U16SlavePointer + 1 < GLOB_U16SlaveSize ) ? GLOB_U16SlavePointer + 1 : 0;
+			GLOB_U16SlaveWritten++;
+		}
+		break;
+
+	/* STOP or REPEATED START: record the end of the frame or notify the application of the registers written */
+	case ACTION_SLAVE_STOP:
+		if (GLOB_U8FrameOpen)
+		{
+			if ( (u8)(GLOB_U8FrameHead - GLOB_U8FrameTail) < FRAME_QUEUE_SIZE )
+			{
+				GLOB_AU8FrameEnds[GLOB_U8FrameHead & FRAME_QUEUE_MASK] = GLOB_U8RingHead;
+				GLOB_U8FrameHead++;
+				GLOB_U8FrameOpen = 0;
+			}
+			else
+			{
+				/* Frame queue full: hold the bus until the consumer frees a boundary */
+				GLOB_U8SlaveStalled = 1;
+				LOC_U8Control = TWCR_SLAVE_STALL;
+			}
+		}
+		if (GLOB_U16SlaveWritten != 0 && GLOB_VidSlavePtrCallBack != NULL)
+		{
+			(*GLOB_VidSlavePtrCallBack)(GLOB_U16SlaveWriteStart, GLOB_U16SlaveWritten);
+		}
+		GLOB_U16SlaveWritten = 0;
+		break;
+
+	/* Addressed for a read operation: the buffer is sent from its first byte */
+	case ACTION_SLAVE_TRANSMIT_START:
+	case ACTION_SLAVE_TRANSMIT_START_LOST:
+		GLOB_U16SlaveTxIndex = 0;
+		/* fall through */
+	/* Addressed for a read operation or the previous byte was acknowledged: load the next byte */
+	case ACTION_SLAVE_TRANSMIT_DATA:
+		if (GLOB_U8SlaveTxBuffer != NULL)
+		{
+			TWDR_REGISTER = GLOB_U8SlaveTxBuffer[GLOB_U16SlaveTxIndex++];
+			/* Tell the hardware when the buffer's last byte is being sent */
+			if (GLOB_U16SlaveTxIndex >= GLOB_U16SlaveTxLength)
+			{
+				LOC_U8Control = TWCR_SLAVE_LAST;
+			}
+		}
+		else if (GLOB_U8SlavePtrProducer != NULL)
+		{
+			u8 LOC_U8Data;
+			if ( (*GLOB_U8SlavePtrProducer)(&LOC_U8Data) )
+			{
+				TWDR_REGISTER = LOC_U8Data;
+			}
+			else
+			{
+				TWDR_REGISTER = SLAVE_IDLE_BYTE;
+				LOC_U8Control = TWCR_SLAVE_LAST;
+			}
+		}
+		else if (GLOB_U8SlaveRegisters != NULL)
+		{
+			TWDR_REGISTER = GLOB_U8SlaveRegisters[GLOB_U16SlavePointer];
+			GLOB_U16SlavePointer = ( GLOB_U16SlavePointer + 1 < GLOB_U16SlaveSize ) ? GLOB_U16SlavePointer + 1 : 0;
+		}
+		else
+		{
+			TWDR_REGISTER = SLAVE_IDLE_BYTE;
+		}
+		break;
+
+	/* The last data byte was answered with NACK or the master ended the read: listen again */
+	case ACTION_SLAVE_RECEIVE_LAST:
+	case ACTION_SLAVE_TRANSMIT_END:
+		break;
+
+	/* Bus error: release the bus and listen again */
+	default:
+		LOC_U8Control = TWCR_SLAVE_RECOVER;
+		break;
+	}
+
+	/* Do not drop the START condition of a transaction waiting for the bus */
+	if (GLOB_PtrTransaction != NULL && PHASE_START == GLOB_U8Phase)
+	{
+		LOC_U8Control |= TWCR_PENDING_START;
+	}
+	return LOC_U8Control;
+}
+
+static void I2C_VidSlaveListen(void)
+{
+	GLOB_U8SlaveStalled = 0;
+	GLOB_U8SlaveControl = TWCR_SLAVE_LISTEN;
+	/* Acknowledge own address from now on and answer the master from the interrupt routine */
+	SET_BIT(TWCR_REGISTER, TWEA);
+	SET_BIT(TWCR_REGISTER, TWIE);
+}
+
+static void I2C_VidFinishTransaction(const u8 LOC_U8Status, const u8 LOC_U8Control)
+{
+	I2C_Transaction* const LOC_PtrTransaction = GLOB_PtrTransaction;
+	LOC_PtrTransaction->Status = LOC_U8Status;
+	/* Notify the owner first so that the work it submits is chained below */
+	if (LOC_PtrTransaction->CallBack != NULL)
+	{
+		(*LOC_PtrTransaction->CallBack)(LOC_PtrTransaction->Context, LOC_U8Status, LOC_PtrTransaction->Transferred);
+	}
+	/* Chain the next queued transaction right after the STOP (or as soon as
+	 * the bus is free again), otherwise finish with the interrupt disabled
+	 */
+	if (GLOB_U8QueueTail != GLOB_U8QueueHead)
+	{
+		I2C_Transaction* const LOC_PtrNext = GLOB_APtrQueue[GLOB_U8QueueTail & QUEUE_MASK];
+		GLOB_U8QueueTail++;
+		if ( LOC_PtrNext->Speed != NULL && \
+				( LOC_PtrNext->Speed->BitRate != GLOB_StrSpeed.BitRate || LOC_PtrNext->Speed->Prescaler != GLOB_StrSpeed.Prescaler ) )
+		{
+			/* The STOP condition goes out at the old speed, the START at the new one */
+			TWCR_REGISTER = LOC_U8Control | GLOB_U8SlaveControl;
+			I2C_VidPrepareTransaction(LOC_PtrNext);
+			TWCR_REGISTER = TWCR_REQUEST_START | GLOB_U8SlaveControl;
+		}
+		else
+		{
+			I2C_VidPrepareTransaction(LOC_PtrNext);
+			TWCR_REGISTER = LOC_U8Control | TWCR_CHAIN | GLOB_U8SlaveControl;
+		}
+	}
+	else
+	{
+		GLOB_PtrTransaction = NULL;
+		TWCR_REGISTER = LOC_U8Control | GLOB_U8SlaveControl;
+	}
+	/* Notify the application that the transaction is finished */
+	if (GLOB_VidI2CPtrCallBack != NULL)
+	{
+		(*GLOB_VidI2CPtrCallBack)();
+	}
+}
+
+static void I2C_VidArbitrationLost(const u8 LOC_U8Control)
+{
+	I2C_Transaction* const LOC_PtrTransaction = GLOB_PtrTransaction;
+	if (LOC_PtrTransaction->Retries < ARBITRATION_RETRIES)
+	{
+		/* Replay the whole transaction from its START condition */
+		LOC_PtrTransaction->Retries++;
+		LOC_PtrTransaction->Transferred = 0;
+		GLOB_U16Index = 0;
+		GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+		GLOB_U8BackoffTicks = I2C_U8BackoffTicks(LOC_PtrTransaction->Retries);
+		if (GLOB_U8BackoffTicks == 0)
+		{
+			/* START is sent by the hardware as soon as the bus is free */
+			GLOB_U8Phase = PHASE_START;
+			TWCR_REGISTER = LOC_U8Control | TWCR_CHAIN | GLOB_U8SlaveControl;
+		}
+		else
+		{
+			/* START is sent by I2C_U8MasterTick once the wait is over */
+			GLOB_U8Phase = PHASE_BACKOFF;
+			TWCR_REGISTER = LOC_U8Control | GLOB_U8SlaveControl;
+		}
+	}
+	else
+	{
+		I2C_VidFinishTransaction(ARBITRATION_LOST, LOC_U8Control);
+	}
+}
+
+static u8 I2C_U8BackoffTicks(const u8 LOC_U8Attempt)
+{
+	u16 LOC_U16Window = BACKOFF_WINDOW_TICKS;
+	/* Binary exponential backoff: the window is 2, 4, 8... up to BACKOFF_WINDOW_TICKS */
+	if (LOC_U8Attempt < 8 && ( (u16)1 << LOC_U8Attempt ) < LOC_U16Window)
+	{
+		LOC_U16Window = (u16)1 << LOC_U8Attempt;
+	}
+	if (LOC_U16Window == 0)
+	{
+		return 0;
+	}
+	/* Step the LFSR and draw a wait from 0 (no wait) to the window minus one */
+	GLOB_U16Random = ( GLOB_U16Random >> 1 ) ^ ( ( GLOB_U16Random & 1 ) ? RANDOM_TAPS : 0 );
+	return (u8)( GLOB_U16Random % LOC_U16Window );
+}
+
+#if ENABLE_STATISTICS == STATISTICS
+static u16 I2C_U16Count(const I2C_StatusEntry* const LOC_PtrEntry)
+{
+	const u8 LOC_U8Counters = LOC_PtrEntry->Counters;
+	u16 LOC_U16Busy = 0;
+	if (LOC_U8Counters != COUNT_NONE)
+	{
+		/* The busy time of a transaction runs from its START condition to its last event */
+		if (LOC_U8Counters & COUNT_TRANSACTION)
+		{
+			GLOB_StrBusStats.Transactions++;
+			GLOB_U16BusyMark = TCNT1_REGISTER;
+		}
+		else if (LOC_U8Counters & COUNT_BUSY)
+		{
+			const u16 LOC_U16Now = TCNT1_REGISTER;
+			LOC_U16Busy = LOC_U16Now - GLOB_U16BusyMark;
+			GLOB_StrBusStats.BusyTime += LOC_U16Busy;
+			GLOB_U16BusyMark = LOC_U16Now;
+		}
+		if (LOC_U8Counters & COUNT_WRITTEN)
+		{
+			GLOB_StrBusStats.BytesWritten++;
+		}
+		else if (LOC_U8Counters & COUNT_READ)
+		{
+			GLOB_StrBusStats.BytesRead++;
+		}
+		if (LOC_U8Counters & COUNT_ACK)
+		{
+			GLOB_StrBusStats.Acks++;
+		}
+		else if (LOC_U8Counters & COUNT_NACK)
+		{
+			GLOB_StrBusStats.Nacks++;
+		}
+		else if (LOC_U8Counters & COUNT_LOST)
+		{
+			GLOB_StrBusStats.ArbitrationLosses++;
+		}
+	}
+	/* Busy time added by the event */
+	return LOC_U16Busy;
+}
+
+static void I2C_VidCountEvent(u16* const LOC_PtrCounter)
+{
+	const u8 LOC_U8Sreg = SREG_REGISTER;
+	/* The interrupt routine updates the statistics too */
+	CLR_BIT(SREG_REGISTER, SREG_I);
+	(*LOC_PtrCounter)++;
+	GLOB_U8StatsVersion++;
+	SREG_REGISTER = LOC_U8Sreg;
+}
+#endif
+
+#if ENABLE_TRACE == TRACE
+static void I2C_VidTrace(const u8 LOC_U8Status)
+{
+	/* Overwrite the oldest event once the trace is full */
+	I2C_TraceEntry* const LOC_PtrEntry = &GLOB_AStrTrace[GLOB_U8TraceHead & TRACE_MASK];
+	LOC_PtrEntry->Time = TCNT1_REGISTER;
+	LOC_PtrEntry->Status = LOC_U8Status;
+	LOC_PtrEntry->Data = TWDR_REGISTER;
+	GLOB_U8TraceHead++;
+	if (GLOB_U8TraceCount < TRACE_SIZE)
+	{
+		GLOB_U8TraceCount++;
+	}
+}
+#endif
+
+static void I2C_VidPrepareTransaction(I2C_Transaction* const LOC_PtrTransaction)
+{
+	LOC_PtrTransaction->Transferred = 0;
+	LOC_PtrTransaction->Retries = 0;
+	GLOB_U16Index = 0;
+	GLOB_U8Phase = PHASE_START;
+	GLOB_U16EngineTicks = ENGINE_TIMEOUT_TICKS;
+	/* Switch to the speed of the addressed device between transactions (after the STOP condition) */
+	if (LOC_PtrTransaction->Speed != NULL)
+	{
+		I2C_U8WriteSpeed(LOC_PtrTransaction->Speed);
+	}
+	GLOB_PtrTransaction = LOC_PtrTransaction;
+}
+
+static u8 I2C_U8WriteSpeed(const I2C_SpeedProfile* const LOC_PtrProfile)
+{
+	if (LOC_PtrProfile != NULL && LOC_PtrProfile->BitRate >= MINIMUM_BIT_RATE && LOC_PtrProfile->Prescaler < PRESCALER_OPTIONS)
+	{
+		/* Only touch the registers if the speed actually changes */
+		if (LOC_PtrProfile->BitRate != GLOB_StrSpeed.BitRate || LOC_PtrProfile->Prescaler != GLOB_StrSpeed.Prescaler)
+		{
+			u32 LOC_U32Budget = GLOB_U32TimeoutFloor;
+			/* A STOP condition still being sent is finished at the old speed */
+			while (GET_BIT(TWCR_REGISTER, TWSTO) && --LOC_U32Budget != 0)
+			{
+			}
+			TWBR_REGISTER = LOC_PtrProfile->BitRate;
+			GLOB_StrSpeed.BitRate = LOC_PtrProfile->BitRate;
+			/* Status bits are read only, so the prescaler bits can be written directly */
+			TWSR_REGISTER = LOC_PtrProfile->Prescaler;
+			GLOB_StrSpeed.Prescaler = LOC_PtrProfile->Prescaler;
+			/* A slower bus needs a longer wait per byte */
+			I2C_VidUpdateTimeoutFloor();
+		}
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+static void I2C_VidServiceTimeout(void)
+{
+	if (GLOB_U8TimeoutPending)
+	{
+		const u8 LOC_U8Sreg = SREG_REGISTER;
+		/* The interrupt routine must not take the bus back in the middle of the recovery */
+		CLR_BIT(SREG_REGISTER, SREG_I);
+		GLOB_U8TimeoutPending = 0;
+		/* A bus event since the timeout was flagged restarted the engine timeout: nothing to do */
+		if (GLOB_PtrTransaction != NULL && GLOB_U16EngineTicks == 0 && PHASE_BACKOFF != GLOB_U8Phase && !GLOB_U8SlaveStalled)
+		{
+			/* Free the bus and give up on the transaction */
+#if ENABLE_BUS_RECOVERY == BUS_RECOVERY
+			I2C_U8BusRecovery();
+#endif
+			COUNT_EVENT(Timeouts);
+			I2C_VidFinishTransaction(TIMEOUT, TWCR_STOP);
+		}
+		SREG_REGISTER = LOC_U8Sreg;
+	}
+}
+
+static void I2C_VidUpdateTimeoutFloor(void)
+{
+	/* CPU cycles of one byte and its acknowledge at the speed in TWBR and TWPS */
+	const u32 LOC_U32ByteCycles = (u32)BITS_PER_BYTE * \
+			( SCL_FIXED_CYCLES + (u32)SCL_BIT_RATE_FACTOR * GLOB_StrSpeed.BitRate * GLOB_AU8Prescalers[GLOB_StrSpeed.Prescaler] );
+	GLOB_U32TimeoutFloor = LOC_U32ByteCycles / POLL_LOOP_CYCLES * TIMEOUT_BYTE_TIMES;
+}
+
+static u8 I2C_U8StartConditionSequence(void)
+{
+	/* Clear Stop Condition */
+	CLR_BIT(TWCR_REGISTER, TWSTO);
+	/* Set Start Condition */
+	SET_BIT(TWCR_REGISTER, TWSTA);
+	/* Clear Flag - Start Operation */
+	SET_BIT(TWCR_REGISTER, TWINT);
+
+	/* Wait until START condition has been transmitted */
+	return I2C_U8WaitSequence(ROLE_MASTER);
+}
+
+static u8 I2C_U8InfoSequence(const u8 LOC_U8Role)
+{
+	/* Clear Start Condition */
+	CLR_BIT(TWCR_REGISTER, TWSTA);
+	/* Clear Stop Condition */
+	CLR_BIT(TWCR_REGISTER, TWSTO);
+	/* Clear Flag - Start Operation */
+	SET_BIT(TWCR_REGISTER, TWINT);
+
+	/* Wait until info byte has been transmitted or received */
+	return I2C_U8WaitSequence(LOC_U8Role);
+}
+static u8 I2C_U8DecodeStatus(const u8 LOC_U8Event, const u8 LOC_U8Class, const u8 LOC_U8Error)
+{
+	/* Look up the outcome of the status code */
+	const I2C_StatusEntry* const LOC_PtrEntry = &GLOB_AStrStatusTable[ STATUS_INDEX(LOC_U8Event) ];
+
+	/* The outcome is valid only if the status code belongs to the operation
+	 * that was performed (or arbitration was lost or the operation timed out)
+	 */
+	if (LOC_U8Class == LOC_PtrEntry->Class || CLASS_ARBITRATION == LOC_PtrEntry->Class || CLASS_TIMEOUT == LOC_PtrEntry->Class)
+	{
+		return LOC_PtrEntry->Outcome;
+	}
+	else
+	{
+		if (ADDRESS_ERROR == LOC_U8Error)
+		{
+			COUNT_EVENT(AddressErrors);
+		}
+		else if (DATA_ERROR == LOC_U8Error)
+		{
+			COUNT_EVENT(DataErrors);
+		}
+		return LOC_U8Error;
+	}
+}
+
+static u8 I2C_U8TransferSequence(const u8 LOC_U8Control)
+{
+	/* Clear Flag - Start Operation with the whole control value at once */
+	TWCR_REGISTER = LOC_U8Control;
+
+	/* Wait until info byte has been transmitted or received */
+	return I2C_U8WaitSequence(ROLE_MASTER);
+}
+
+static u8 I2C_U8WaitSequence(const u8 LOC_U8Role)
+{
+	u32 LOC_U32Budget = ( GLOB_U32TimeoutBudget > GLOB_U32TimeoutFloor ) ? GLOB_U32TimeoutBudget : GLOB_U32TimeoutFloor;
+	u8 LOC_U8Status;
+#if ENABLE_STATISTICS == STATISTICS
+	const I2C_StatusEntry* LOC_PtrEntry;
+	u8 LOC_U8Sreg;
+	u16 LOC_U16Busy;
+#endif
+	/* Wait until the flag is set or the timeout budget runs out */
+	while ( !TWINT_FLAG )
+	{
+		if (--LOC_U32Budget == 0)
+		{
+			COUNT_EVENT(Timeouts);
+#if ENABLE_BUS_RECOVERY == BUS_RECOVERY
+			/* A slave only reports the timeout: the bus belongs to the master */
+			if (ROLE_MASTER == LOC_U8Role)
+			{
+				I2C_U8BusRecovery();
+			}
+#endif
+			return NO_INFO_STATUS;
+		}
+	}
+	/* Return the status code without the prescaler bits */
+	LOC_U8Status = TWSR_REGISTER & MASK_PRESCALER_BITS;
+#if ENABLE_STATISTICS == STATISTICS
+	LOC_PtrEntry = &GLOB_AStrStatusTable[ STATUS_INDEX(LOC_U8Status) ];
+	/* The interrupt routine updates the statistics too */
+	LOC_U8Sreg = SREG_REGISTER;
+	CLR_BIT(SREG_REGISTER, SREG_I);
+	LOC_U16Busy = I2C_U16Count(LOC_PtrEntry);
+	GLOB_U8StatsVersion++;
+	SREG_REGISTER = LOC_U8Sreg;
+	/* A device transfer only takes the events of its own master operations */
+	if (ROLE_MASTER == LOC_U8Role && GLOB_PtrDeviceStats != NULL)
+	{
+		if (LOC_PtrEntry->Counters & COUNT_ACK)
+		{
+			GLOB_PtrDeviceStats->Acks++;
+		}
+		GLOB_PtrDeviceStats->BusyTime += LOC_U16Busy;
+	}
+#endif
+#if ENABLE_TRACE == TRACE
+	I2C_VidTrace(LOC_U8Status);
+#endif
+	return LOC_U8Status;
+}
+static u8 I2C_U8DeviceTransfer(I2C_Device* const LOC_PtrDevice, const u8* const LOC_U8TxData, const u16 LOC_U16TxLength, u8* const LOC_U8RxData, const u16 LOC_U16RxLength, u8* const LOC_U8Status)
+{
+	/* The blocking functions cannot share the bus with a submitted transaction */
+	if (LOC_PtrDevice != NULL && LOC_U8Status != NULL && GLOB_PtrTransaction == NULL)
+	{
+		const I2C_SpeedProfile LOC_StrSaved = GLOB_StrSpeed;
+		const u32 LOC_U32Budget = GLOB_U32TimeoutBudget;
+		u8 LOC_U8Attempt = 0, LOC_U8Retry, LOC_U8Error;
+
+		/* Use the device's own speed and timeout for this transaction */
+		I2C_U8SetSpeed(&LOC_PtrDevice->Speed);
+		GLOB_U32TimeoutBudget = LOC_PtrDevice->Timeout;
+		LOC_PtrDevice->Stats.Transactions++;
+#if ENABLE_STATISTICS == STATISTICS
+		/* Acks and busy time of the attempts go to the device as they happen */
+		GLOB_PtrDeviceStats = &LOC_PtrDevice->Stats;
+#endif
+
+		do
+		{
+			LOC_U8Error = I2C_U8MasterWriteRead(LOC_PtrDevice->Address, LOC_U8TxData, LOC_U16TxLength, LOC_U8RxData, LOC_U16RxLength, LOC_U8Status);
+			LOC_U8Retry = ( NO_ERROR == LOC_U8Error && COMPLETED != *LOC_U8Status );
+			if (LOC_U8Retry)
+			{
+				/* Count what went wrong with the failed attempt */
+				if (RECEIVED_NACK == *LOC_U8Status)
+				{
+					LOC_PtrDevice->Stats.Nacks++;
+				}
+				else if (ARBITRATION_LOST == *LOC_U8Status)
+				{
+					LOC_PtrDevice->Stats.ArbitrationLosses++;
+				}
+				else if (TIMEOUT == *LOC_U8Status)
+				{
+					LOC_PtrDevice->Stats.Timeouts++;
+				}
+				else if (ADDRESS_ERROR == *LOC_U8Status)
+				{
+					LOC_PtrDevice->Stats.AddressErrors++;
+				}
+				else if (DATA_ERROR == *LOC_U8Status)
+				{
+					LOC_PtrDevice->Stats.DataErrors++;
+				}
+				else
+				{
+					LOC_PtrDevice->Stats.Errors++;
+				}
+				/* Retry as long as the device allows it */
+				if (LOC_U8Attempt < LOC_PtrDevice->MaxRetries)
+				{
+					LOC_U8Attempt++;
+					LOC_PtrDevice->Stats.Retries++;
+				}
+				else
+				{
+					LOC_U8Retry = 0;
+				}
+			}
+		} while (LOC_U8Retry);
+
+		if (NO_ERROR == LOC_U8Error && COMPLETED == *LOC_U8Status)
+		{
+			LOC_PtrDevice->Stats.BytesWritten += LOC_U16TxLength;
+			LOC_PtrDevice->Stats.BytesRead += LOC_U16RxLength;
+		}
+#if ENABLE_STATISTICS == STATISTICS
+		GLOB_PtrDeviceStats = NULL;
+#endif
+
+		/* Restore the global speed and timeout */
+		I2C_U8SetSpeed(&LOC_StrSaved);
+		GLOB_U32TimeoutBudget = LOC_U32Budget;
+		return LOC_U8Error;
+	}
+	else
+	{
+		return ERROR;
+	}
 }
 /************************************************************************************/
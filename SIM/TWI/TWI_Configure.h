@@ -0,0 +1,59 @@
+/*
+ * TWI_Configure.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef SIM_TWI_TWI_CONFIGURE_H_
+#define SIM_TWI_TWI_CONFIGURE_H_
+
+/*****************************************************************************/
+/*   POLL COST - CPU CYCLES OF ONE ITERATION OF A LOOP THAT POLLS THE TWINT  */
+/*   FLAG ON THE TARGET - RANGE OF OPTIONS: 1 ~ 255                          */
+/*****************************************************************************/
+#define POLL_CYCLES								4
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   ACCESS COST - CPU CYCLES OF ONE ACCESS TO A TWI REGISTER BY THE DRIVER  */
+/*   (THE I/O INSTRUCTION AND THE CODE AROUND IT) - RANGE: 0 ~ 255           */
+/*****************************************************************************/
+#define ACCESS_CYCLES							2
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   INTERRUPT COST - CPU CYCLES TO ENTER AND LEAVE THE TWI INTERRUPT        */
+/*   ROUTINE (VECTOR JUMP, CONTEXT SAVE AND RESTORE) - RANGE: 1 ~ 255        */
+/*****************************************************************************/
+#define INTERRUPT_CYCLES						40
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   MAXIMUM NUMBER OF SLAVES ATTACHED TO THE SIMULATED BUS - RANGE: 1 ~ 127 */
+/*****************************************************************************/
+#define MAXIMUM_SLAVES							8
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   REMOTE MASTER QUEUE SIZE - NUMBER OF TRANSFERS OF OTHER MASTERS THAT    */
+/*   CAN WAIT FOR THE BUS - RANGE OF OPTIONS: 1 ~ 255                        */
+/*****************************************************************************/
+#define REMOTE_QUEUE_SIZE						8
+/*****************************************************************************/
+
+
+/*****************************************************************************/
+/*   REMOTE MASTER GAP - SCL PERIODS THE BUS STAYS FREE BEFORE A REMOTE      */
+/*   MASTER STARTS ITS TRANSFER - RANGE OF OPTIONS: 0 ~ 255                  */
+/*****************************************************************************/
+#define REMOTE_GAP_PERIODS						2
+/*****************************************************************************/
+
+
+
+#endif /* SIM_TWI_TWI_CONFIGURE_H_ */
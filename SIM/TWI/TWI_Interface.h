@@ -0,0 +1,312 @@
+/*
+ * TWI_Interface.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef SIM_TWI_TWI_INTERFACE_H_
+#define SIM_TWI_TWI_INTERFACE_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+/*************************************************************************************/
+/* 							HOST MODEL OF THE TWI PERIPHERAL						 */
+/*************************************************************************************/
+/* Behavioural model of the ATmega32 TWI block (TWCR, TWSR, TWDR, TWAR and TWBR) and */
+/* of the bus around it, used to run the drivers on a Linux host. When the drivers	 */
+/* are compiled with HOST_SIMULATION defined, their register macros point into the	 */
+/* I/O space of this model instead of the hardware addresses:						 */
+/*																					 */
+/* gcc -std=gnu99 -DHOST_SIMULATION -DF_CPU=8000000UL main.c						 */
+/*     MCAL/I2C/I2C_Program.c MCAL/DIO/DIO_Program.c SIM/TWI/TWI_Program.c			 */
+/*																					 */
+/* Time is a virtual clock counted in CPU cycles. It only advances when the driver	 */
+/* accesses a register or polls the interrupt flag, when the application calls		 */
+/* TWI_U8Run or inside the _delay_ms/_delay_us macros, so bus timing does not		 */
+/* depend on the host speed.														 */
+/* Every bus operation takes the number of SCL periods it needs on a real bus at	 */
+/* the SCL frequency selected by TWBR and the prescaler bits of TWSR.				 */
+/* Differences with the hardware: writes to TWCR are acted upon at the next access	 */
+/* to a TWI register, and the TWINT bit always reads as 0 from TWCR (the flag is	 */
+/* read through TWI_U8Flag instead).												 */
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 								 	I/O SPACE	   					 			     */
+/*************************************************************************************/
+#define TWI_IO_SPACE_SIZE			0x60
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						USEFUL MACROS AS FUNCTIONS' ARGUMENTS   					 */
+/*************************************************************************************/
+#define TWI_ACK						1
+#define TWI_NACK					0
+#define TWI_REMOTE_WRITE			0
+#define TWI_REMOTE_READ				1
+#define TWI_BUS_FREE				0
+#define TWI_BUS_STUCK				1
+#define TWI_BUS_STUCK_UNTIL_RESET	2
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  			SIMULATED SLAVE									 */
+/*************************************************************************************/
+/* A device that answers the master on the simulated bus. Every callback receives	 */
+/* the Context pointer and can be NULL:												 */
+/* Addressed: the slave was addressed for a read (1) or a write (0) operation, it	 */
+/* returns TWI_ACK or TWI_NACK (acknowledged if NULL).								 */
+/* Write: a data byte was received, it returns TWI_ACK or TWI_NACK (acknowledged if	 */
+/* NULL).																			 */
+/* Read: the master reads a byte, it returns the byte (0xFF if NULL).				 */
+/* Stop: the transfer with this slave ended with a STOP or a REPEATED START.		 */
+/*************************************************************************************/
+typedef struct
+{
+	u8 Address;
+	void* Context;
+	u8 (*Addressed)(void* Context, u8 Read);
+	u8 (*Write)(void* Context, u8 Data);
+	u8 (*Read)(void* Context);
+	void (*Stop)(void* Context);
+} TWI_Slave;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		SIMULATED MEMORY SLAVE								 */
+/*************************************************************************************/
+/* Ready-made slave that behaves like a register file or a small EEPROM: the first	 */
+/* byte of a write sets the register pointer, the following bytes are stored and	 */
+/* reads return the registers from the pointer on. The pointer wraps at Size.		 */
+/*************************************************************************************/
+typedef struct
+{
+	TWI_Slave Slave;
+	u8* Memory;
+	u16 Size;
+	u16 Pointer;
+	u8 PointerSet;
+} TWI_MemorySlave;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		REMOTE MASTER TRANSFER								 */
+/*************************************************************************************/
+/* Transfer issued on the bus by another master, used to exercise the slave mode	 */
+/* of the driver. Direction is TWI_REMOTE_WRITE (the remote master sends Buffer) or	 */
+/* TWI_REMOTE_READ (the remote master reads Length bytes into Buffer). Transferred	 */
+/* counts the bytes that went on the bus and Done is set to 1 once the remote		 */
+/* master released the bus. Acked is 1 if the address byte was acknowledged.		 */
+/*************************************************************************************/
+typedef struct
+{
+	u8 Address;
+	u8 Direction;
+	u8* Buffer;
+	u16 Length;
+	volatile u16 Transferred;
+	volatile u8 Acked;
+	volatile u8 Done;
+} TWI_RemoteTransfer;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  			BUS STATISTICS									 */
+/*************************************************************************************/
+/* A response is the write to TWCR that clears the flag: ResponseCycles adds up the	 */
+/* cycles between the flag being set and the driver clearing it, which is the time	 */
+/* the bus is stretched between two operations.										 */
+/*************************************************************************************/
+typedef struct
+{
+	u32 Starts;
+	u32 RepeatedStarts;
+	u32 Stops;
+	u32 Bytes;
+	u32 Nacks;
+	u32 ArbitrationLosses;
+	u32 Interrupts;
+	u32 Polls;
+	u32 Accesses;
+	u32 Responses;
+	u32 MaxResponseCycles;
+	u64 ResponseCycles;
+	u64 BusyCycles;
+} TWI_Stats;
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		REGISTER REDIRECTION								 */
+/*************************************************************************************/
+/* Backing store of the I/O registers, indexed by their data memory address.		 */
+/*************************************************************************************/
+extern volatile u8 TWI_AU8IoSpace[TWI_IO_SPACE_SIZE];
+/*************************************************************************************/
+
+
+/*************************************************************************************/
+/* 						  		DELAY REDIRECTION									 */
+/*************************************************************************************/
+#ifndef F_CPU
+#define F_CPU						8000000UL
+#endif
+#define _delay_us(us)				TWI_U8Run( (u32)( (us) * ( F_CPU / 1000000UL ) ) )
+#define _delay_ms(ms)				TWI_U8Run( (u32)( (ms) * ( F_CPU / 1000UL ) ) )
+/*************************************************************************************/
+
+
+/************************************************************************************/
+/* 								FUNCTIONS PROTOTYPE					 				*/
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: resets the model to its power-on state: registers cleared, bus		*/
+/* free, virtual clock and statistics at 0, no slaves attached and no remote		*/
+/* transfers pending. Global interrupts are enabled.								*/
+/* Input      : nothing 		                                                    */
+/* Output     : error checking                                                      */
+/************************************************************************************/
+extern u8 TWI_U8Reset(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: returns the address of a TWI register after bringing the model up	*/
+/* to date with the previous accesses. Used by the register macros of the driver.	*/
+/* Input: data memory address of the register										*/
+/* Output: pointer to the register													*/
+/************************************************************************************/
+extern volatile u8* TWI_PtrRegister(const u8 LOC_U8Address);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads the TWINT flag the way a polling loop does: every call costs	*/
+/* the cycles of one iteration of the loop on the target.							*/
+/* Input: nothing																	*/
+/* Output: 1 if the flag is set, 0 otherwise										*/
+/************************************************************************************/
+extern u8 TWI_U8Flag(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads a free-running 16-bit timer clocked by the CPU clock, the		*/
+/* same as TCNT1 of Timer1 running without a prescaler. The read costs the cycles	*/
+/* of one register access.															*/
+/* Input: nothing																	*/
+/* Output: timer value																*/
+/************************************************************************************/
+extern u16 TWI_U16Timer(void);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: advances the virtual clock, performing the bus operations that end	*/
+/* in that time and executing the TWI interrupt routine whenever the flag is set	*/
+/* while the interrupt is enabled.													*/
+/* Input: number of CPU cycles														*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8Run(const u32 LOC_U32Cycles);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: advances the virtual clock until no bus operation is in progress	*/
+/* and no remote transfer is pending, or until the limit is reached.				*/
+/* Input: maximum number of CPU cycles												*/
+/* Output: error checking (an error is returned if the limit was reached)			*/
+/************************************************************************************/
+extern u8 TWI_U8RunUntilIdle(const u32 LOC_U32Limit);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: enables (1) or disables (0) the interrupts globally, the same as	*/
+/* the I bit of SREG (which the driver can also access at address 0x5F).			*/
+/* Input: state																		*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8SetGlobalInterrupt(const u8 LOC_U8State);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: connects a slave to the bus. The descriptor must stay valid until	*/
+/* the next reset.																	*/
+/* Input: pointer to the slave														*/
+/* Output: error checking (an error is returned if too many slaves are attached)	*/
+/************************************************************************************/
+extern u8 TWI_U8AttachSlave(TWI_Slave* const LOC_PtrSlave);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: initializes a memory slave and connects it to the bus.				*/
+/* Input: pointer to the slave - address - pointer to the memory - memory size		*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8AttachMemorySlave(TWI_MemorySlave* const LOC_PtrSlave, const u8 LOC_U8Address, u8* const LOC_U8Memory, const u16 LOC_U16Size);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: queues a transfer of a remote master. It starts as soon as the bus	*/
+/* is free and the peripheral is enabled with its acknowledge bit set.				*/
+/* Input: pointer to the transfer													*/
+/* Output: error checking (an error is returned if the queue is full)				*/
+/************************************************************************************/
+extern u8 TWI_U8RemoteTransfer(TWI_RemoteTransfer* const LOC_PtrTransfer);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: makes the next address bytes sent by the driver lose arbitration	*/
+/* against another master, which then keeps the bus for one byte.					*/
+/* Input: number of address bytes that lose arbitration								*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8InjectArbitrationLoss(const u8 LOC_U8Count);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: makes a slave hold SDA low so that no bus operation completes.		*/
+/* Possible arguments:																*/
+/*  TWI_BUS_FREE: the bus works normally.											*/
+/*  TWI_BUS_STUCK: the bus stays stuck until this function is called again.		*/
+/*  TWI_BUS_STUCK_UNTIL_RESET: the bus is freed the next time the peripheral is	*/
+/*   disabled, as done by the bus recovery of the driver.							*/
+/* Input: state																		*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8SetStuck(const u8 LOC_U8State);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: sets a function that is called on every response of the driver		*/
+/* with the status code being answered and the cycles elapsed since the flag was	*/
+/* set. Passing NULL removes the monitor.											*/
+/* Input: pointer to the monitor function											*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8SetMonitor( void (*LOC_PtrMonitor) (u8 LOC_U8Status, u32 LOC_U32Cycles) );
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads the virtual clock.											*/
+/* Input: pointer to a variable to receive the number of CPU cycles in				*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8GetCycles(u64* const LOC_U64Cycles);
+/************************************************************************************/
+
+/************************************************************************************/
+/* Description: reads the bus statistics since the last reset.						*/
+/* Input: pointer to a structure to receive the statistics in						*/
+/* Output: error checking															*/
+/************************************************************************************/
+extern u8 TWI_U8GetStats(TWI_Stats* const LOC_PtrStats);
+/************************************************************************************/
+
+
+
+#endif /* SIM_TWI_TWI_INTERFACE_H_ */
@@ -0,0 +1,149 @@
+/*
+ * TWI_Private.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+#ifndef SIM_TWI_TWI_PRIVATE_H_
+#define SIM_TWI_TWI_PRIVATE_H_
+
+
+/***********************************************************************************/
+/*  							  REGISTERS ADDRESSES							   */
+/***********************************************************************************/
+#define TWCR_ADDRESS 								0x56
+#define TWDR_ADDRESS 								0x23
+#define TWAR_ADDRESS 								0x22
+#define TWSR_ADDRESS 								0x21
+#define TWBR_ADDRESS 								0x20
+#define PINC_ADDRESS 								0x33
+#define SREG_ADDRESS 								0x5F
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					              SREG REGISTER BITS							   */
+/***********************************************************************************/
+#define SREG_I										7
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					              TWCR REGISTER BITS							   */
+/***********************************************************************************/
+#define TWINT										7
+#define TWEA										6
+#define TWSTA										5
+#define TWSTO										4
+#define TWEN										2
+#define TWIE										0
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					              TWAR REGISTER BITS							   */
+/***********************************************************************************/
+#define TWGCE										0
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					              PORT C BUS PINS								   */
+/***********************************************************************************/
+#define SCL_PIN										0
+#define SDA_PIN										1
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					             	 STATUS CODES								   */
+/***********************************************************************************/
+#define BUS_ERROR_STATUS							0x00
+#define START_STATUS								0x08
+#define REPEATED_START_STATUS						0x10
+#define ADDRESS_WRITE_ACK_STATUS					0x18
+#define ADDRESS_WRITE_NACK_STATUS					0x20
+#define SENT_DATA_ACK_STATUS						0x28
+#define SENT_DATA_NACK_STATUS						0x30
+#define ARBITRATION_LOST_STATUS						0x38
+#define ADDRESS_READ_ACK_STATUS						0x40
+#define ADDRESS_READ_NACK_STATUS					0x48
+#define RECEIVED_DATA_ACK_STATUS					0x50
+#define RECEIVED_DATA_NACK_STATUS					0x58
+#define SLA_ADDRESSED_ACK_STATUS					0x60
+#define GC_ADDRESSED_ACK_STATUS						0x70
+#define SLA_ADDRESSED_ACK_DATA_STATUS				0x80
+#define SLA_ADDRESSED_NACK_DATA_STATUS				0x88
+#define GC_ADDRESSED_ACK_DATA_STATUS				0x90
+#define GC_ADDRESSED_NACK_DATA_STATUS				0x98
+#define SLAVE_STOP_STATUS							0xA0
+#define SLA_ADDRESSED_READ_ACK_STATUS				0xA8
+#define SLAVE_SENT_ACK_STATUS						0xB8
+#define SLAVE_SENT_NACK_STATUS						0xC0
+#define SLAVE_LAST_DATA_ACK_STATUS					0xC8
+#define NO_INFO_STATUS								0xF8
+#define MASK_PRESCALER_SELECT_BITS					0x03
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					               SCL PERIOD FORMULA					   	   	   */
+/* SCL PERIOD IN CPU CYCLES = 16 + (2 * BIT RATE * PRESCALER)					   */
+/***********************************************************************************/
+#define SCL_FIXED_CYCLES							16
+#define SCL_BIT_RATE_FACTOR							2
+#define BYTE_PERIODS								9
+#define CONDITION_PERIODS							1
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					             	 BUS MODES									   */
+/***********************************************************************************/
+#define MODE_IDLE									0
+#define MODE_MASTER_ADDRESS							1
+#define MODE_MASTER_TRANSMIT						2
+#define MODE_MASTER_RECEIVE							3
+#define MODE_ARBITRATION_LOST						4
+#define MODE_SLAVE_RECEIVE							5
+#define MODE_SLAVE_TRANSMIT							6
+#define MODE_SLAVE_END								7
+#define MODE_REMOTE_ADDRESS							8
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 					           	   OTHER DEFINITIONS							   */
+/***********************************************************************************/
+#define SHIFT_BY_ONE								1
+#define READ_OPERATION								1
+#define GENERAL_CALL_ADDRESS						0
+#define DEFAULT_READ_DATA							0xFF
+#define TWI_VECTOR									__vector_19
+/***********************************************************************************/
+
+
+/***********************************************************************************/
+/* 							  PRIVATE FUNCTIONS PROTOTYPE 						   */
+/***********************************************************************************/
+extern void TWI_VECTOR(void);
+static void TWI_VidSync(void);
+static void TWI_VidResponse(void);
+static void TWI_VidCommand(const u8 LOC_U8Control);
+static void TWI_VidSchedule(const u32 LOC_U32Periods, const u8 LOC_U8Status);
+static void TWI_VidStartRemote(void);
+static void TWI_VidAddressRemote(void);
+static void TWI_VidEndRemote(void);
+static void TWI_VidEndSlave(void);
+static void TWI_VidAdvance(const u64 LOC_U64Target);
+static u32 TWI_U32Period(void);
+static TWI_Slave* TWI_PtrFindSlave(const u8 LOC_U8Address);
+static u8 TWI_U8MemoryWrite(void* LOC_PtrContext, u8 LOC_U8Data);
+static u8 TWI_U8MemoryRead(void* LOC_PtrContext);
+static void TWI_VidMemoryStop(void* LOC_PtrContext);
+/***********************************************************************************/
+
+
+
+#endif /* SIM_TWI_TWI_PRIVATE_H_ */
@@ -0,0 +1,696 @@
+/*
+ * TWI_Program.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Omar Fahmy
+ */
+
+/* LIB LAYER */
+#include "../../LIB/COMMON_MACROS.h"
+#include "../../LIB/STD_TYPES.h"
+#include "../../LIB/BIT_MATH.h"
+/* SIM LAYER */
+#include "TWI_Interface.h"
+#include "TWI_Configure.h"
+#include "TWI_Private.h"
+
+volatile u8 TWI_AU8IoSpace[TWI_IO_SPACE_SIZE];
+
+/* Virtual clock in CPU cycles */
+static u64 GLOB_U64Now = 0;
+/* Time at which the bus is free again after a STOP or a transfer of another master */
+static u64 GLOB_U64BusFreeAt = 0;
+/* Peripheral state: enable bit seen, interrupt flag, status code and bus mode */
+static u8 GLOB_U8Enabled = 0;
+static u8 GLOB_U8Flag = 0;
+static u8 GLOB_U8Status = NO_INFO_STATUS;
+static u8 GLOB_U8Mode = MODE_IDLE;
+/* Bus operation in progress: it sets the flag with its status code when it ends */
+static u8 GLOB_U8EventPending = 0;
+static u64 GLOB_U64EventTime = 0;
+static u8 GLOB_U8EventStatus = NO_INFO_STATUS;
+static u8 GLOB_U8EventLoad = 0;
+static u8 GLOB_U8EventData = 0;
+/* START requested while addressed as a slave, sent once the bus is free */
+static u8 GLOB_U8PendingStart = 0;
+/* Nesting guard of the interrupt routine (the I bit is kept in SREG of the I/O space) */
+static u8 GLOB_U8InInterrupt = 0;
+/* Injected faults */
+static u8 GLOB_U8Stuck = TWI_BUS_FREE;
+static u8 GLOB_U8ArbitrationLosses = 0;
+/* Slaves on the bus and the one addressed by the driver */
+static TWI_Slave* GLOB_APtrSlaves[MAXIMUM_SLAVES];
+static u8 GLOB_U8SlavesCount = 0;
+static TWI_Slave* GLOB_PtrSlave = NULL;
+/* Transfers of other masters waiting for the bus and the one in progress */
+static TWI_RemoteTransfer* GLOB_APtrRemote[REMOTE_QUEUE_SIZE];
+static u8 GLOB_U8RemoteHead = 0;
+static u8 GLOB_U8RemoteCount = 0;
+static TWI_RemoteTransfer* GLOB_PtrRemote = NULL;
+static u8 GLOB_U8RemoteGeneralCall = 0;
+static TWI_Stats GLOB_StrStats;
+/* Time the flag was last set and the function told about every response */
+static u64 GLOB_U64FlagTime = 0;
+static void (*GLOB_VidPtrMonitor)(u8 LOC_U8Status, u32 LOC_U32Cycles) = NULL;
+
+/************************************************************************************/
+/* 						  PUBLIC FUNCTIONS IMPLEMENTATION	  						*/
+/************************************************************************************/
+u8 TWI_U8Reset(void)
+{
+	for (u8 LOC_U8Address = 0; LOC_U8Address < TWI_IO_SPACE_SIZE; LOC_U8Address++)
+	{
+		TWI_AU8IoSpace[LOC_U8Address] = 0;
+	}
+	TWI_AU8IoSpace[TWSR_ADDRESS] = NO_INFO_STATUS;
+	SET_BIT(TWI_AU8IoSpace[SREG_ADDRESS], SREG_I);
+	GLOB_U64Now = 0;
+	GLOB_U64BusFreeAt = 0;
+	GLOB_U8Enabled = 0;
+	GLOB_U8Flag = 0;
+	GLOB_U8Status = NO_INFO_STATUS;
+	GLOB_U8Mode = MODE_IDLE;
+	GLOB_U8EventPending = 0;
+	GLOB_U8PendingStart = 0;
+	GLOB_U8InInterrupt = 0;
+	GLOB_U8Stuck = TWI_BUS_FREE;
+	GLOB_U8ArbitrationLosses = 0;
+	GLOB_U8SlavesCount = 0;
+	GLOB_PtrSlave = NULL;
+	GLOB_U8RemoteHead = 0;
+	GLOB_U8RemoteCount = 0;
+	GLOB_PtrRemote = NULL;
+	GLOB_StrStats = (TWI_Stats){ 0 };
+	GLOB_U64FlagTime = 0;
+	GLOB_VidPtrMonitor = NULL;
+	TWI_VidSync();
+	return NO_ERROR;
+}
+
+volatile u8* TWI_PtrRegister(const u8 LOC_U8Address)
+{
+	/* Act upon the previous write before the register is accessed again */
+	GLOB_StrStats.Accesses++;
+	TWI_VidAdvance(GLOB_U64Now + ACCESS_CYCLES);
+	return &TWI_AU8IoSpace[LOC_U8Address];
+}
+
+u8 TWI_U8Flag(void)
+{
+	GLOB_StrStats.Polls++;
+	TWI_VidAdvance(GLOB_U64Now + POLL_CYCLES);
+	return GLOB_U8Flag;
+}
+
+u16 TWI_U16Timer(void)
+{
+	GLOB_StrStats.Accesses++;
+	TWI_VidAdvance(GLOB_U64Now + ACCESS_CYCLES);
+	return (u16)GLOB_U64Now;
+}
+
+u8 TWI_U8Run(const u32 LOC_U32Cycles)
+{
+	TWI_VidAdvance(GLOB_U64Now + LOC_U32Cycles);
+	return NO_ERROR;
+}
+
+u8 TWI_U8RunUntilIdle(const u32 LOC_U32Limit)
+{
+	const u64 LOC_U64Deadline = GLOB_U64Now + LOC_U32Limit;
+	TWI_VidAdvance(GLOB_U64Now);
+	while ( ( GLOB_U8EventPending || GLOB_PtrRemote != NULL || GLOB_U8RemoteCount != 0 ) && GLOB_U64Now < LOC_U64Deadline )
+	{
+		/* Jump from one bus event to the next one */
+		if (GLOB_U8EventPending && GLOB_U64EventTime < LOC_U64Deadline)
+		{
+			TWI_VidAdvance(GLOB_U64EventTime);
+		}
+		else
+		{
+			TWI_VidAdvance(LOC_U64Deadline);
+		}
+	}
+	if (GLOB_U8EventPending || GLOB_PtrRemote != NULL || GLOB_U8RemoteCount != 0)
+	{
+		return ERROR;
+	}
+	else
+	{
+		return NO_ERROR;
+	}
+}
+
+u8 TWI_U8SetGlobalInterrupt(const u8 LOC_U8State)
+{
+	WRITE_BIT(TWI_AU8IoSpace[SREG_ADDRESS], SREG_I, LOC_U8State);
+	return NO_ERROR;
+}
+
+u8 TWI_U8AttachSlave(TWI_Slave* const LOC_PtrSlave)
+{
+	if (LOC_PtrSlave != NULL && GLOB_U8SlavesCount < MAXIMUM_SLAVES)
+	{
+		GLOB_APtrSlaves[GLOB_U8SlavesCount++] = LOC_PtrSlave;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 TWI_U8AttachMemorySlave(TWI_MemorySlave* const LOC_PtrSlave, const u8 LOC_U8Address, u8* const LOC_U8Memory, const u16 LOC_U16Size)
+{
+	if (LOC_PtrSlave != NULL && LOC_U8Memory != NULL && LOC_U16Size != 0)
+	{
+		LOC_PtrSlave->Slave.Address = LOC_U8Address;
+		LOC_PtrSlave->Slave.Context = LOC_PtrSlave;
+		LOC_PtrSlave->Slave.Addressed = NULL;
+		LOC_PtrSlave->Slave.Write = TWI_U8MemoryWrite;
+		LOC_PtrSlave->Slave.Read = TWI_U8MemoryRead;
+		LOC_PtrSlave->Slave.Stop = TWI_VidMemoryStop;
+		LOC_PtrSlave->Memory = LOC_U8Memory;
+		LOC_PtrSlave->Size = LOC_U16Size;
+		LOC_PtrSlave->Pointer = 0;
+		LOC_PtrSlave->PointerSet = 0;
+		return TWI_U8AttachSlave(&LOC_PtrSlave->Slave);
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 TWI_U8RemoteTransfer(TWI_RemoteTransfer* const LOC_PtrTransfer)
+{
+	if (LOC_PtrTransfer != NULL && GLOB_U8RemoteCount < REMOTE_QUEUE_SIZE && \
+			( LOC_PtrTransfer->Length == 0 || LOC_PtrTransfer->Buffer != NULL ) )
+	{
+		LOC_PtrTransfer->Transferred = 0;
+		LOC_PtrTransfer->Acked = 0;
+		LOC_PtrTransfer->Done = 0;
+		GLOB_APtrRemote[(GLOB_U8RemoteHead + GLOB_U8RemoteCount) % REMOTE_QUEUE_SIZE] = LOC_PtrTransfer;
+		GLOB_U8RemoteCount++;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 TWI_U8InjectArbitrationLoss(const u8 LOC_U8Count)
+{
+	GLOB_U8ArbitrationLosses = LOC_U8Count;
+	return NO_ERROR;
+}
+
+u8 TWI_U8SetStuck(const u8 LOC_U8State)
+{
+	if (LOC_U8State <= TWI_BUS_STUCK_UNTIL_RESET)
+	{
+		GLOB_U8Stuck = LOC_U8State;
+		TWI_VidSync();
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 TWI_U8SetMonitor( void (*LOC_PtrMonitor) (u8 LOC_U8Status, u32 LOC_U32Cycles) )
+{
+	GLOB_VidPtrMonitor = LOC_PtrMonitor;
+	return NO_ERROR;
+}
+
+u8 TWI_U8GetCycles(u64* const LOC_U64Cycles)
+{
+	if (LOC_U64Cycles != NULL)
+	{
+		*LOC_U64Cycles = GLOB_U64Now;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+
+u8 TWI_U8GetStats(TWI_Stats* const LOC_PtrStats)
+{
+	if (LOC_PtrStats != NULL)
+	{
+		*LOC_PtrStats = GLOB_StrStats;
+		return NO_ERROR;
+	}
+	else
+	{
+		return ERROR;
+	}
+}
+/************************************************************************************/
+
+
+/************************************************************************************/
+/* 						  PRIVATE FUNCTIONS IMPLEMENTATION  						*/
+/************************************************************************************/
+static void TWI_VidSync(void)
+{
+	const u8 LOC_U8Control = TWI_AU8IoSpace[TWCR_ADDRESS];
+	if ( !GET_BIT(LOC_U8Control, TWEN) )
+	{
+		if (GLOB_U8Enabled)
+		{
+			/* Disabling the peripheral aborts the operation in progress and frees the pins */
+			GLOB_U8Enabled = 0;
+			GLOB_U8EventPending = 0;
+			GLOB_U8Flag = 0;
+			GLOB_U8PendingStart = 0;
+			GLOB_U8Mode = MODE_IDLE;
+			TWI_VidEndSlave();
+			if (GLOB_PtrRemote != NULL)
+			{
+				TWI_VidEndRemote();
+			}
+			if (TWI_BUS_STUCK_UNTIL_RESET == GLOB_U8Stuck)
+			{
+				GLOB_U8Stuck = TWI_BUS_FREE;
+			}
+		}
+		CLR_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWINT);
+	}
+	else
+	{
+		GLOB_U8Enabled = 1;
+		/* Writing one to TWINT clears the flag and starts the selected operation */
+		if ( GET_BIT(LOC_U8Control, TWINT) )
+		{
+			CLR_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWINT);
+			if (GLOB_U8Flag)
+			{
+				TWI_VidResponse();
+			}
+			GLOB_U8Flag = 0;
+			TWI_VidCommand(LOC_U8Control);
+		}
+		/* With the flag cleared, setting TWSTA alone requests a START (sent once the bus is free) */
+		else if ( GET_BIT(LOC_U8Control, TWSTA) && !GLOB_U8Flag && ( MODE_IDLE == GLOB_U8Mode || MODE_REMOTE_ADDRESS == GLOB_U8Mode ) )
+		{
+			TWI_VidCommand(LOC_U8Control);
+		}
+	}
+	/* Status bits read 0xF8 while the flag is cleared, the prescaler bits are kept */
+	TWI_AU8IoSpace[TWSR_ADDRESS] = ( GLOB_U8Flag ? GLOB_U8Status : NO_INFO_STATUS ) | ( TWI_AU8IoSpace[TWSR_ADDRESS] & MASK_PRESCALER_SELECT_BITS );
+	/* Bus lines as seen on the port C pins, SDA is low while a slave holds it */
+	SET_BIT(TWI_AU8IoSpace[PINC_ADDRESS], SCL_PIN);
+	WRITE_BIT(TWI_AU8IoSpace[PINC_ADDRESS], SDA_PIN, ( TWI_BUS_FREE == GLOB_U8Stuck ));
+}
+
+static void TWI_VidResponse(void)
+{
+	const u32 LOC_U32Cycles = GLOB_U64Now - GLOB_U64FlagTime;
+	GLOB_StrStats.Responses++;
+	GLOB_StrStats.ResponseCycles += LOC_U32Cycles;
+	if (LOC_U32Cycles > GLOB_StrStats.MaxResponseCycles)
+	{
+		GLOB_StrStats.MaxResponseCycles = LOC_U32Cycles;
+	}
+	if (GLOB_VidPtrMonitor != NULL)
+	{
+		(*GLOB_VidPtrMonitor)(GLOB_U8Status, LOC_U32Cycles);
+	}
+}
+
+static void TWI_VidCommand(const u8 LOC_U8Control)
+{
+	const u8 LOC_U8Start = GET_BIT(LOC_U8Control, TWSTA);
+	const u8 LOC_U8Stop = GET_BIT(LOC_U8Control, TWSTO);
+	const u8 LOC_U8Ack = GET_BIT(LOC_U8Control, TWEA);
+	const u8 LOC_U8Data = TWI_AU8IoSpace[TWDR_ADDRESS];
+	u8 LOC_U8Result = TWI_ACK;
+
+	/* The peripheral ignores commands while an operation is in progress,
+	 * except a START that waits for the transfer of another master to end
+	 */
+	if (GLOB_U8EventPending)
+	{
+		if (MODE_REMOTE_ADDRESS == GLOB_U8Mode)
+		{
+			GLOB_U8PendingStart |= LOC_U8Start;
+		}
+		return;
+	}
+	switch (GLOB_U8Mode)
+	{
+	case MODE_MASTER_ADDRESS:
+	case MODE_MASTER_TRANSMIT:
+	case MODE_MASTER_RECEIVE:
+		if (LOC_U8Stop)
+		{
+			/* STOP condition, followed by a START if TWSTA is also set */
+			TWI_VidEndSlave();
+			GLOB_StrStats.Stops++;
+			GLOB_U64BusFreeAt = GLOB_U64Now + (u64)CONDITION_PERIODS * TWI_U32Period();
+			GLOB_StrStats.BusyCycles += (u64)CONDITION_PERIODS * TWI_U32Period();
+			CLR_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWSTO);
+			GLOB_U8Mode = MODE_IDLE;
+			if (LOC_U8Start)
+			{
+				GLOB_StrStats.Starts++;
+				GLOB_U8Mode = MODE_MASTER_ADDRESS;
+				TWI_VidSchedule(CONDITION_PERIODS, START_STATUS);
+			}
+		}
+		else if (LOC_U8Start)
+		{
+			TWI_VidEndSlave();
+			GLOB_StrStats.RepeatedStarts++;
+			GLOB_U8Mode = MODE_MASTER_ADDRESS;
+			TWI_VidSchedule(CONDITION_PERIODS, REPEATED_START_STATUS);
+		}
+		else if (MODE_MASTER_ADDRESS == GLOB_U8Mode)
+		{
+			const u8 LOC_U8Read = GET_BIT(LOC_U8Data, 0);
+			GLOB_StrStats.Bytes++;
+			if (GLOB_U8ArbitrationLosses != 0)
+			{
+				/* Another master wins the address byte and keeps the bus for one more byte */
+				GLOB_U8ArbitrationLosses--;
+				GLOB_StrStats.ArbitrationLosses++;
+				GLOB_U8Mode = MODE_ARBITRATION_LOST;
+				TWI_VidSchedule(BYTE_PERIODS, ARBITRATION_LOST_STATUS);
+				GLOB_U64BusFreeAt = GLOB_U64EventTime + (u64)(BYTE_PERIODS + CONDITION_PERIODS) * TWI_U32Period();
+			}
+			else
+			{
+				GLOB_PtrSlave = TWI_PtrFindSlave(LOC_U8Data >> SHIFT_BY_ONE);
+				if (GLOB_PtrSlave == NULL || ( GLOB_PtrSlave->Addressed != NULL && \
+						(*GLOB_PtrSlave->Addressed)(GLOB_PtrSlave->Context, LOC_U8Read) != TWI_ACK ))
+				{
+					GLOB_PtrSlave = NULL;
+					LOC_U8Result = TWI_NACK;
+					GLOB_StrStats.Nacks++;
+				}
+				if (READ_OPERATION == LOC_U8Read)
+				{
+					GLOB_U8Mode = MODE_MASTER_RECEIVE;
+					TWI_VidSchedule(BYTE_PERIODS, ( TWI_ACK == LOC_U8Result ) ? ADDRESS_READ_ACK_STATUS : ADDRESS_READ_NACK_STATUS);
+				}
+				else
+				{
+					GLOB_U8Mode = MODE_MASTER_TRANSMIT;
+					TWI_VidSchedule(BYTE_PERIODS, ( TWI_ACK == LOC_U8Result ) ? ADDRESS_WRITE_ACK_STATUS : ADDRESS_WRITE_NACK_STATUS);
+				}
+			}
+		}
+		else if (MODE_MASTER_TRANSMIT == GLOB_U8Mode)
+		{
+			GLOB_StrStats.Bytes++;
+			if (GLOB_PtrSlave == NULL || ( GLOB_PtrSlave->Write != NULL && \
+					(*GLOB_PtrSlave->Write)(GLOB_PtrSlave->Context, LOC_U8Data) != TWI_ACK ))
+			{
+				LOC_U8Result = TWI_NACK;
+				GLOB_StrStats.Nacks++;
+			}
+			TWI_VidSchedule(BYTE_PERIODS, ( TWI_ACK == LOC_U8Result ) ? SENT_DATA_ACK_STATUS : SENT_DATA_NACK_STATUS);
+		}
+		else
+		{
+			GLOB_StrStats.Bytes++;
+			TWI_VidSchedule(BYTE_PERIODS, LOC_U8Ack ? RECEIVED_DATA_ACK_STATUS : RECEIVED_DATA_NACK_STATUS);
+			GLOB_U8EventLoad = 1;
+			GLOB_U8EventData = ( GLOB_PtrSlave != NULL && GLOB_PtrSlave->Read != NULL ) ? (*GLOB_PtrSlave->Read)(GLOB_PtrSlave->Context) : DEFAULT_READ_DATA;
+		}
+		break;
+	case MODE_IDLE:
+	case MODE_ARBITRATION_LOST:
+		/* STOP in a non addressed mode only recovers the peripheral */
+		CLR_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWSTO);
+		GLOB_U8Mode = MODE_IDLE;
+		if (LOC_U8Start)
+		{
+			/* START is transmitted as soon as the bus is free */
+			GLOB_StrStats.Starts++;
+			GLOB_U8Mode = MODE_MASTER_ADDRESS;
+			TWI_VidSchedule(CONDITION_PERIODS, START_STATUS);
+		}
+		break;
+	case MODE_SLAVE_RECEIVE:
+		GLOB_U8PendingStart |= LOC_U8Start;
+		if (SLA_ADDRESSED_NACK_DATA_STATUS == GLOB_U8Status || GC_ADDRESSED_NACK_DATA_STATUS == GLOB_U8Status)
+		{
+			/* Not addressed anymore after a NACK: the remote master sends STOP */
+			GLOB_U8Mode = MODE_IDLE;
+			TWI_VidEndRemote();
+		}
+		else if (GLOB_PtrRemote->Transferred < GLOB_PtrRemote->Length)
+		{
+			GLOB_StrStats.Bytes++;
+			if (GLOB_U8RemoteGeneralCall)
+			{
+				TWI_VidSchedule(BYTE_PERIODS, LOC_U8Ack ? GC_ADDRESSED_ACK_DATA_STATUS : GC_ADDRESSED_NACK_DATA_STATUS);
+			}
+			else
+			{
+				TWI_VidSchedule(BYTE_PERIODS, LOC_U8Ack ? SLA_ADDRESSED_ACK_DATA_STATUS : SLA_ADDRESSED_NACK_DATA_STATUS);
+			}
+			GLOB_U8EventLoad = 1;
+			GLOB_U8EventData = GLOB_PtrRemote->Buffer[GLOB_PtrRemote->Transferred++];
+		}
+		else
+		{
+			/* The remote master has nothing more to send */
+			GLOB_U8Mode = MODE_SLAVE_END;
+			TWI_VidSchedule(CONDITION_PERIODS, SLAVE_STOP_STATUS);
+		}
+		break;
+	case MODE_SLAVE_TRANSMIT:
+		GLOB_U8PendingStart |= LOC_U8Start;
+		GLOB_StrStats.Bytes++;
+		GLOB_PtrRemote->Buffer[GLOB_PtrRemote->Transferred++] = LOC_U8Data;
+		/* The remote master acknowledges every byte but the last one it wants */
+		if (GLOB_PtrRemote->Transferred < GLOB_PtrRemote->Length)
+		{
+			if (LOC_U8Ack)
+			{
+				TWI_VidSchedule(BYTE_PERIODS, SLAVE_SENT_ACK_STATUS);
+			}
+			else
+			{
+				GLOB_U8Mode = MODE_SLAVE_END;
+				TWI_VidSchedule(BYTE_PERIODS, SLAVE_LAST_DATA_ACK_STATUS);
+			}
+		}
+		else
+		{
+			GLOB_U8Mode = MODE_SLAVE_END;
+			TWI_VidSchedule(BYTE_PERIODS, SLAVE_SENT_NACK_STATUS);
+		}
+		break;
+	case MODE_SLAVE_END:
+		GLOB_U8PendingStart |= LOC_U8Start;
+		GLOB_U8Mode = MODE_IDLE;
+		TWI_VidEndRemote();
+		break;
+	default:
+		break;
+	}
+}
+
+static void TWI_VidSchedule(const u32 LOC_U32Periods, const u8 LOC_U8Status)
+{
+	const u64 LOC_U64Duration = (u64)LOC_U32Periods * TWI_U32Period();
+	/* A stuck bus never completes an operation */
+	if (TWI_BUS_FREE == GLOB_U8Stuck)
+	{
+		GLOB_U64EventTime = ( GLOB_U64BusFreeAt > GLOB_U64Now ? GLOB_U64BusFreeAt : GLOB_U64Now ) + LOC_U64Duration;
+		GLOB_U8EventStatus = LOC_U8Status;
+		GLOB_U8EventLoad = 0;
+		GLOB_U8EventPending = 1;
+		GLOB_StrStats.BusyCycles += LOC_U64Duration;
+	}
+}
+
+static void TWI_VidStartRemote(void)
+{
+	if (GLOB_U8RemoteCount == 0 || GLOB_PtrRemote != NULL || MODE_IDLE != GLOB_U8Mode || GLOB_U8Flag || \
+			!GLOB_U8Enabled || TWI_BUS_FREE != GLOB_U8Stuck)
+	{
+		return;
+	}
+	GLOB_PtrRemote = GLOB_APtrRemote[GLOB_U8RemoteHead];
+	GLOB_U8RemoteHead = (GLOB_U8RemoteHead + 1) % REMOTE_QUEUE_SIZE;
+	GLOB_U8RemoteCount--;
+	GLOB_StrStats.Starts++;
+	GLOB_StrStats.Bytes++;
+	GLOB_U8RemoteGeneralCall = ( GENERAL_CALL_ADDRESS == GLOB_PtrRemote->Address );
+	/* START and address byte of the remote master, answered when the byte ends */
+	GLOB_U8Mode = MODE_REMOTE_ADDRESS;
+	TWI_VidSchedule(REMOTE_GAP_PERIODS + CONDITION_PERIODS + BYTE_PERIODS, NO_INFO_STATUS);
+}
+
+static void TWI_VidAddressRemote(void)
+{
+	const u8 LOC_U8OwnAddress = TWI_AU8IoSpace[TWAR_ADDRESS] >> SHIFT_BY_ONE;
+	/* The peripheral only answers while its acknowledge bit is set */
+	if ( GET_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWEA) && ( GLOB_PtrRemote->Address == LOC_U8OwnAddress || \
+			( GLOB_U8RemoteGeneralCall && GET_BIT(TWI_AU8IoSpace[TWAR_ADDRESS], TWGCE) ) ) )
+	{
+		GLOB_PtrRemote->Acked = 1;
+		if (TWI_REMOTE_READ == GLOB_PtrRemote->Direction)
+		{
+			GLOB_U8Mode = MODE_SLAVE_TRANSMIT;
+			GLOB_U8Status = SLA_ADDRESSED_READ_ACK_STATUS;
+		}
+		else
+		{
+			GLOB_U8Mode = MODE_SLAVE_RECEIVE;
+			GLOB_U8Status = GLOB_U8RemoteGeneralCall ? GC_ADDRESSED_ACK_STATUS : SLA_ADDRESSED_ACK_STATUS;
+		}
+		GLOB_U8Flag = 1;
+		GLOB_U64FlagTime = GLOB_U64Now;
+	}
+	else
+	{
+		/* Nobody answers: the remote master gives up after its address byte */
+		GLOB_StrStats.Nacks++;
+		GLOB_U8Mode = MODE_IDLE;
+		TWI_VidEndRemote();
+	}
+}
+
+static void TWI_VidEndRemote(void)
+{
+	/* The remote master releases the bus with a STOP condition */
+	GLOB_StrStats.Stops++;
+	GLOB_U64BusFreeAt = GLOB_U64Now + (u64)CONDITION_PERIODS * TWI_U32Period();
+	GLOB_PtrRemote->Done = 1;
+	GLOB_PtrRemote = NULL;
+	if (GLOB_U8PendingStart)
+	{
+		GLOB_U8PendingStart = 0;
+		GLOB_StrStats.Starts++;
+		GLOB_U8Mode = MODE_MASTER_ADDRESS;
+		TWI_VidSchedule(CONDITION_PERIODS, START_STATUS);
+	}
+}
+
+static void TWI_VidEndSlave(void)
+{
+	if (GLOB_PtrSlave != NULL && GLOB_PtrSlave->Stop != NULL)
+	{
+		(*GLOB_PtrSlave->Stop)(GLOB_PtrSlave->Context);
+	}
+	GLOB_PtrSlave = NULL;
+}
+
+static void TWI_VidAdvance(const u64 LOC_U64Target)
+{
+	for (;;)
+	{
+		TWI_VidSync();
+		if (!GLOB_U8EventPending)
+		{
+			TWI_VidStartRemote();
+		}
+		if ( GLOB_U8Flag && GET_BIT(TWI_AU8IoSpace[TWCR_ADDRESS], TWIE) && GET_BIT(TWI_AU8IoSpace[SREG_ADDRESS], SREG_I) && \
+				!GLOB_U8InInterrupt && GLOB_U64Now <= LOC_U64Target )
+		{
+			/* The flag is set with the interrupt enabled: execute the interrupt routine
+			 * with the I bit cleared, RETI sets it again
+			 */
+			GLOB_U8InInterrupt = 1;
+			GLOB_U64Now += INTERRUPT_CYCLES;
+			GLOB_StrStats.Interrupts++;
+			CLR_BIT(TWI_AU8IoSpace[SREG_ADDRESS], SREG_I);
+			TWI_VECTOR();
+			SET_BIT(TWI_AU8IoSpace[SREG_ADDRESS], SREG_I);
+			GLOB_U8InInterrupt = 0;
+		}
+		else if (GLOB_U8EventPending && GLOB_U64EventTime <= LOC_U64Target)
+		{
+			/* The operation in progress ends: set the flag with its status code */
+			if (GLOB_U64EventTime > GLOB_U64Now)
+			{
+				GLOB_U64Now = GLOB_U64EventTime;
+			}
+			GLOB_U8EventPending = 0;
+			if (MODE_REMOTE_ADDRESS == GLOB_U8Mode)
+			{
+				TWI_VidAddressRemote();
+				continue;
+			}
+			GLOB_U8Status = GLOB_U8EventStatus;
+			if (GLOB_U8EventLoad)
+			{
+				TWI_AU8IoSpace[TWDR_ADDRESS] = GLOB_U8EventData;
+			}
+			GLOB_U8Flag = 1;
+			GLOB_U64FlagTime = GLOB_U64Now;
+		}
+		else
+		{
+			break;
+		}
+	}
+	if (GLOB_U64Now < LOC_U64Target)
+	{
+		GLOB_U64Now = LOC_U64Target;
+	}
+	TWI_VidSync();
+}
+
+static u32 TWI_U32Period(void)
+{
+	/* Prescaler value is 4 to the power of the TWPS1:TWPS0 bits */
+	const u32 LOC_U32Prescaler = 1UL << ( 2 * ( TWI_AU8IoSpace[TWSR_ADDRESS] & MASK_PRESCALER_SELECT_BITS ) );
+	return SCL_FIXED_CYCLES + SCL_BIT_RATE_FACTOR * (u32)TWI_AU8IoSpace[TWBR_ADDRESS] * LOC_U32Prescaler;
+}
+
+static TWI_Slave* TWI_PtrFindSlave(const u8 LOC_U8Address)
+{
+	for (u8 LOC_U8Index = 0; LOC_U8Index < GLOB_U8SlavesCount; LOC_U8Index++)
+	{
+		if (GLOB_APtrSlaves[LOC_U8Index]->Address == LOC_U8Address)
+		{
+			return GLOB_APtrSlaves[LOC_U8Index];
+		}
+	}
+	return NULL;
+}
+
+static u8 TWI_U8MemoryWrite(void* LOC_PtrContext, u8 LOC_U8Data)
+{
+	TWI_MemorySlave* const LOC_PtrSlave = LOC_PtrContext;
+	/* The first byte of a write selects the register */
+	if (!LOC_PtrSlave->PointerSet)
+	{
+		LOC_PtrSlave->Pointer = LOC_U8Data % LOC_PtrSlave->Size;
+		LOC_PtrSlave->PointerSet = 1;
+	}
+	else
+	{
+		LOC_PtrSlave->Memory[LOC_PtrSlave->Pointer] = LOC_U8Data;
+		LOC_PtrSlave->Pointer = (LOC_PtrSlave->Pointer + 1) % LOC_PtrSlave->Size;
+	}
+	return TWI_ACK;
+}
+
+static u8 TWI_U8MemoryRead(void* LOC_PtrContext)
+{
+	TWI_MemorySlave* const LOC_PtrSlave = LOC_PtrContext;
+	const u8 LOC_U8Data = LOC_PtrSlave->Memory[LOC_PtrSlave->Pointer];
+	LOC_PtrSlave->Pointer = (LOC_PtrSlave->Pointer + 1) % LOC_PtrSlave->Size;
+	return LOC_U8Data;
+}
+
+static void TWI_VidMemoryStop(void* LOC_PtrContext)
+{
+	TWI_MemorySlave* const LOC_PtrSlave = LOC_PtrContext;
+	/* The next write starts with a register address again */
+	LOC_PtrSlave->PointerSet = 0;
+}
+/************************************************************************************/